@@ -0,0 +1,257 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Anim.h>
+#include <Crc.h>
+
+static volatile const uint8 FLASH_ALIGN FLASH_SECTION animStore[ANIM_STORE_ROWS][FLASH_ROW_SIZE] = {{0}};
+
+/* animReady is set once the stream in the store has been checked, and
+* cleared by every write to it. animPos is the offset of the next frame to
+* decode, 0 until playback has started on the stream. */
+static volatile uint8 animReady = FALSE;
+static uint16 animFrames;
+static uint16 animFrame;
+static uint16 animPos;
+static uint8 animFps;
+static uint16 animTicks;
+
+/*******************************************************************************
+* Function Name: Frame
+********************************************************************************
+*
+* Summary:
+*  Walks the frame at 'pos', XORing it into the framebuffer if 'apply' is
+*  set. A keyframe is XORed with what is shown, so it too only touches the
+*  bytes that differ.
+*
+* Return:
+*  The offset of the next frame, or 0 if the frame is malformed or runs past
+*  the end of the store.
+*
+*******************************************************************************/
+static uint16 Frame(uint16 pos, uint8 apply)
+{
+    const volatile uint8 *s = animStore[0];
+    const volatile uint8 *mask;
+    uint8 type, y, b, i, n, bits;
+    
+    if (pos >= ANIM_STORE_SIZE)
+    {
+        return 0;
+    }
+    type = s[pos++];
+    
+    if (type == ANIM_FRAME_KEY)
+    {
+        if (ANIM_KEY_SIZE > (ANIM_STORE_SIZE - pos))
+        {
+            return 0;
+        }
+        for (y = 0; apply && (y < FB_HEIGHT); y++)
+        {
+            for (b = 0; b < ANIM_ROW_BYTES; b++)
+            {
+                bits = s[pos + (y * ANIM_ROW_BYTES) + b] ^ FramebufferRowByte(y, b);
+                if (bits)
+                {
+                    FramebufferXorByte(y, b, bits);
+                }
+            }
+        }
+        return pos + ANIM_KEY_SIZE;
+    }
+    
+    if (((type != ANIM_FRAME_XOR) && (type != ANIM_FRAME_RLE)) ||
+        (ANIM_MASK_BYTES > (ANIM_STORE_SIZE - pos)))
+    {
+        return 0;
+    }
+    mask = &s[pos];
+    pos += ANIM_MASK_BYTES;
+    
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        if (!(mask[y / 8] & (0x80 >> (y % 8))))
+        {
+            continue;
+        }
+        if (type == ANIM_FRAME_XOR)
+        {
+            if (ANIM_ROW_BYTES > (ANIM_STORE_SIZE - pos))
+            {
+                return 0;
+            }
+            for (b = 0; apply && (b < ANIM_ROW_BYTES); b++)
+            {
+                if (s[pos + b])
+                {
+                    FramebufferXorByte(y, b, s[pos + b]);
+                }
+            }
+            pos += ANIM_ROW_BYTES;
+            continue;
+        }
+        
+        for (b = 0; b < ANIM_ROW_BYTES; b += n)
+        {
+            if (pos >= ANIM_STORE_SIZE)
+            {
+                return 0;
+            }
+            n = (s[pos] & ~ANIM_RLE_SKIP) + 1;
+            if (n > (ANIM_ROW_BYTES - b))
+            {
+                return 0;
+            }
+            if (s[pos++] & ANIM_RLE_SKIP)
+            {
+                continue;
+            }
+            if (n > (ANIM_STORE_SIZE - pos))
+            {
+                return 0;
+            }
+            for (i = 0; apply && (i < n); i++)
+            {
+                FramebufferXorByte(y, b + i, s[pos + i]);
+            }
+            pos += n;
+        }
+    }
+    return pos;
+}
+
+/* Decodes the next frame, going back to the keyframe after the last */
+static void Step(void)
+{
+    if (animFrame >= animFrames)
+    {
+        animFrame = 0;
+        animPos = ANIM_HEADER;
+    }
+    animPos = Frame(animPos, TRUE);
+    animFrame++;
+}
+
+/*******************************************************************************
+* Function Name: AnimWrite
+********************************************************************************
+*
+* Summary:
+*  Checks a write to ANIMATION Control and stores its row of the stream.
+*  Called from the main loop. Playback holds the frame it is on until the new
+*  stream has been checked and played.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if the row was stored, otherwise the error to send.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T AnimWrite(const uint8 *data, uint16 length)
+{
+    uint8 row[FLASH_ROW_SIZE];
+    uint16 crc;
+    
+    if ((length <= ANIM_WRITE_HEADER) || (length > ANIM_WRITE_SIZE))
+    {
+        return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+    }
+    crc = Crc16(Crc16(CRC16_INIT, data, 1), &data[ANIM_WRITE_HEADER], length - ANIM_WRITE_HEADER);
+    if ((data[0] >= ANIM_STORE_ROWS) || (crc != (data[1] | ((uint16)data[2] << 8))))
+    {
+        return CYBLE_GATT_ERR_OUT_OF_RANGE;
+    }
+    
+    animReady = FALSE;
+    animPos = 0;
+    memset(row, 0, FLASH_ROW_SIZE);
+    memcpy(row, &data[ANIM_WRITE_HEADER], length - ANIM_WRITE_HEADER);
+    return FlashWriteRow(animStore[data[0]], row);
+}
+
+/* TRUE if the store holds a whole stream for this panel. Walks every frame,
+* so playback never has to check bounds, and the last one must end where the
+* header says the stream does, not in what an older one left behind. */
+uint8 AnimValid(void)
+{
+    const volatile uint8 *s = animStore[0];
+    uint16 frames = s[3] | ((uint16)s[4] << 8);
+    uint16 size = s[5] | ((uint16)s[6] << 8);
+    uint16 pos = ANIM_HEADER;
+    uint16 i;
+    
+    if ((s[0] != ANIM_MAGIC) || (s[1] != ANIM_ROW_BYTES) || (s[2] != FB_HEIGHT) ||
+        (frames == 0) || (s[ANIM_HEADER] != ANIM_FRAME_KEY))
+    {
+        return FALSE;
+    }
+    for (i = 0; (i < frames) && (pos != 0); i++)
+    {
+        pos = Frame(pos, FALSE);
+    }
+    if ((pos == 0) || (pos != size))
+    {
+        return FALSE;
+    }
+    animFrames = frames;
+    animReady = TRUE;
+    return TRUE;
+}
+
+/*******************************************************************************
+* Function Name: AnimPlay
+********************************************************************************
+*
+* Summary:
+*  Called from CommandApply. Shows the keyframe and plays on from it at 'fps'
+*  frames a second, or only changes the rate if the same stream is already
+*  playing, so fps 0 pauses and a later rate resumes.
+*
+*******************************************************************************/
+void AnimPlay(uint8 fps)
+{
+    if (!animReady)
+    {
+        /* Rewritten since the batch was checked */
+        return;
+    }
+    
+    animFps = fps;
+    if ((displayMode != DISPLAY_MODE_ANIM) || (animPos == 0))
+    {
+        animFrame = 0;
+        animPos = ANIM_HEADER;
+        animTicks = 0;
+        Step();
+        displayMode = DISPLAY_MODE_ANIM;
+    }
+}
+
+/* Called by Display_ISR in animation mode. The frame rate is counted against
+* the tick rate, which ANIM_MAX_FPS stays under. */
+void AnimTick(void)
+{
+    uint16 rate = DisplayTickRate();
+    
+    if (!animReady || (animPos == 0))
+    {
+        return;
+    }
+    
+    animTicks += animFps;
+    if (animTicks >= rate)
+    {
+        animTicks -= rate;
+        Step();
+    }
+}
+
+/* [] END OF FILE */
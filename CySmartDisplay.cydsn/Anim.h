@@ -0,0 +1,73 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _ANIM_H_
+#define _ANIM_H_
+
+#include <main.h>
+#include <Flash.h>
+#include <Framebuffer.h>
+
+/*******************************************************************************
+* Anim Defines
+*******************************************************************************/
+/* A frame sequence kept in flash and played into the framebuffer. Frames are
+* whole panels of pixel rows, ANIM_ROW_BYTES to a row, the leftmost pixel in
+* bit 7 of the first byte. The stream is
+*   'A' [ANIM_ROW_BYTES] [FB_HEIGHT] [frame count, LE] [stream size, LE]
+* then the frames, each a type byte and
+*   ANIM_FRAME_KEY: every byte of every row, top row first
+*   ANIM_FRAME_XOR: a mask of the rows that changed since the last frame, the
+*                   top row in bit 7 of the first byte, then each of those
+*                   rows XORed with the last frame
+*   ANIM_FRAME_RLE: the same mask, then each of those rows as runs of XOR
+*                   bytes: 0x80 | n skips n + 1 bytes, n < 0x80 is followed by
+*                   n + 1 bytes to XOR
+* The first frame is a keyframe, and playback loops back to it after the
+* last one. A frame only touches the rows and bytes it changes, so the commit
+* sends just the digits they fall in.
+*
+* ANIMATION Control writes the stream a flash row at a time:
+*   [row] [CRC-16 of the row number and the data, LE] [up to FLASH_ROW_SIZE bytes]
+* The CRC is the one SPRITE Control uses. The stream is checked when a
+* CMD_TLV_ANIM record asks for it to be played. */
+#define ANIM_MAGIC          'A'
+#define ANIM_HEADER         7
+#define ANIM_ROW_BYTES      (FB_WIDTH / 8)
+#define ANIM_MASK_BYTES     ((FB_HEIGHT + 7) / 8)
+#define ANIM_KEY_SIZE       (FB_HEIGHT * ANIM_ROW_BYTES)
+
+#define ANIM_FRAME_KEY      0
+#define ANIM_FRAME_XOR      1
+#define ANIM_FRAME_RLE      2
+#define ANIM_RLE_SKIP       0x80
+#define ANIM_RLE_MAX        0x80    // bytes in one run
+
+#define ANIM_STORE_ROWS     32      // 4 KB of flash
+#define ANIM_STORE_SIZE     (ANIM_STORE_ROWS * FLASH_ROW_SIZE)
+#define ANIM_WRITE_HEADER   3
+#define ANIM_WRITE_SIZE     (ANIM_WRITE_HEADER + FLASH_ROW_SIZE)   // ANIMATION Control
+
+/* Playback runs on its own timer divider, whatever the scroll speed, and
+* decodes at most one frame per tick */
+#define ANIM_TIMER_DIVIDER  6       // about 107 ticks a second
+#define ANIM_MAX_FPS        50
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T AnimWrite(const uint8 *data, uint16 length);
+uint8 AnimValid(void);
+void AnimPlay(uint8 fps);
+void AnimTick(void);
+
+#endif
+/* [] END OF FILE */
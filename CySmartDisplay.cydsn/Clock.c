@@ -0,0 +1,290 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Clock.h>
+#include <Field.h>
+#include <Framebuffer.h>
+
+static volatile uint32 clockSeconds;
+static uint32 clockEnd;                 // countdown end, 0 for none
+static uint8 clockSet = FALSE;
+static volatile uint8 clockTicked = FALSE;
+
+/* The kind of each field that is a widget, and the minute or second it last
+* showed */
+static uint8 widgetKind[FIELD_COUNT];
+static uint32 widgetShown[FIELD_COUNT];
+
+/* WDT counter 0 callback, once a second */
+static void ClockSecond(void)
+{
+    clockSeconds++;
+    clockTicked = TRUE;
+}
+
+void ClockInit(void)
+{
+    CySysWdtUnlock();
+    CySysWdtSetMode(CY_SYS_WDT_COUNTER0, CY_SYS_WDT_MODE_INT);
+    CySysWdtSetMatch(CY_SYS_WDT_COUNTER0, CLOCK_WDT_MATCH);
+    CySysWdtSetClearOnMatch(CY_SYS_WDT_COUNTER0, 1u);
+    CySysWdtSetInterruptCallback(CY_SYS_WDT_COUNTER0, ClockSecond);
+    CyIntSetVector(CLOCK_WDT_IRQ, &CySysWdtIsr);
+    CyIntEnable(CLOCK_WDT_IRQ);
+    CySysWdtEnable(CY_SYS_WDT_COUNTER0_MASK);
+    CySysWdtLock();
+}
+
+uint32 ClockNow(void)
+{
+    return clockSeconds;
+}
+
+/* Whether the time has been set since the reset */
+uint8 ClockSynced(void)
+{
+    return clockSet;
+}
+
+static char *Two(char *text, uint32 n)
+{
+    *text++ = '0' + ((n / 10) % 10);
+    *text++ = '0' + (n % 10);
+    return text;
+}
+
+/* Day, month and two-digit year of a count of days since 1970-01-01 */
+static void Date(uint32 days, uint8 *day, uint8 *month, uint32 *year)
+{
+    uint32 era, doe, yoe, doy, mp;
+    
+    /* Days since 0000-03-01, in eras of 400 years; March starts the year
+    * so the leap day is the last one */
+    days += 719468u;
+    era = days / 146097u;
+    doe = days - (era * 146097u);
+    yoe = (doe - (doe / 1460u) + (doe / 36524u) - (doe / 146096u)) / 365u;
+    doy = doe - ((365u * yoe) + (yoe / 4u) - (yoe / 100u));
+    mp = ((5u * doy) + 2u) / 153u;
+    *day = (uint8)(doy - (((153u * mp) + 2u) / 5u) + 1u);
+    *month = (uint8)((mp < 10u) ? (mp + 3u) : (mp - 9u));
+    *year = yoe + (era * 400u) + (*month <= 2u);
+}
+
+/*******************************************************************************
+* Function Name: ClockFormat
+********************************************************************************
+*
+* Summary:
+*  Writes what a widget of 'kind' shows now into 'text', which must hold
+*  CLOCK_TEXT_SIZE characters. Not NUL terminated.
+*
+* Return:
+*  The number of characters written.
+*
+*******************************************************************************/
+uint8 ClockFormat(uint8 kind, char *text)
+{
+    uint32 now = clockSeconds;
+    uint32 left, year;
+    uint8 day, month;
+    char *end = text;
+    
+    if (!clockSet || (kind == CLOCK_NONE) || (kind >= CLOCK_KINDS))
+    {
+        memcpy(text, "--:--", 5);
+        return 5;
+    }
+    
+    switch (kind)
+    {
+        case CLOCK_DATE:
+            Date(now / 86400u, &day, &month, &year);
+            end = Two(end, day);
+            *end++ = '.';
+            end = Two(end, month);
+            *end++ = '.';
+            end = Two(end, year);
+            break;
+            
+        case CLOCK_COUNTDOWN:
+            left = ((clockEnd != 0) && (clockEnd > now)) ? (clockEnd - now) : 0;
+            if (left >= 86400u)
+            {
+                /* 10 days or more drop the space to stay within
+                * CLOCK_TEXT_SIZE, and the count stops at 99d23:59 */
+                if (left >= (100u * 86400u))
+                {
+                    left = (100u * 86400u) - 60u;
+                }
+                if (left >= (10u * 86400u))
+                {
+                    end = Two(end, left / 86400u);
+                }
+                else
+                {
+                    *end++ = '0' + (left / 86400u);
+                }
+                *end++ = 'd';
+                if (left < (10u * 86400u))
+                {
+                    *end++ = ' ';
+                }
+                end = Two(end, (left / 3600u) % 24u);
+                *end++ = ':';
+                end = Two(end, (left / 60u) % 60u);
+            }
+            else
+            {
+                end = Two(end, left / 3600u);
+                *end++ = ':';
+                end = Two(end, (left / 60u) % 60u);
+                *end++ = ':';
+                end = Two(end, left % 60u);
+            }
+            break;
+            
+        default:
+            end = Two(end, (now / 3600u) % 24u);
+            *end++ = ':';
+            end = Two(end, (now / 60u) % 60u);
+            if (kind == CLOCK_HHMMSS)
+            {
+                *end++ = ':';
+                end = Two(end, now % 60u);
+            }
+            break;
+    }
+    return (uint8)(end - text);
+}
+
+/* Whether a widget of 'kind' changes every second, or every minute */
+static uint32 Unit(uint8 kind, uint32 now)
+{
+    if ((kind == CLOCK_HHMMSS) || ((kind == CLOCK_COUNTDOWN) && (clockEnd > now) && ((clockEnd - now) < 86400u)))
+    {
+        return now;
+    }
+    return now / 60u;
+}
+
+static void Show(uint8 field)
+{
+    char text[CLOCK_TEXT_SIZE];
+    
+    widgetShown[field] = Unit(widgetKind[field], clockSeconds);
+    FieldSet(field, text, ClockFormat(widgetKind[field], text));
+}
+
+/*******************************************************************************
+* Function Name: ClockWrite
+********************************************************************************
+*
+* Summary:
+*  Sets the time, and the end of the countdown if the write has one, from a
+*  write to CLOCK Control. The WDT counter starts the second over, so the
+*  time is as exact as the write. Widgets show the new time at the next
+*  second.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if the time was set, otherwise the error to send.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T ClockWrite(const uint8 *data, uint16 length)
+{
+    uint8 i;
+    
+    if ((length != 4) && (length != CLOCK_SIZE))
+    {
+        return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+    }
+    
+    CySysWdtUnlock();
+    CySysWdtResetCounters(CY_SYS_WDT_COUNTER0_RESET);
+    CySysWdtLock();
+    clockSeconds = data[0] | ((uint32)data[1] << 8) | ((uint32)data[2] << 16) | ((uint32)data[3] << 24);
+    if (length == CLOCK_SIZE)
+    {
+        clockEnd = data[4] | ((uint32)data[5] << 8) | ((uint32)data[6] << 16) | ((uint32)data[7] << 24);
+    }
+    clockSet = TRUE;
+    
+    for (i = 0; i < FIELD_COUNT; i++)
+    {
+        widgetShown[i] = ~(uint32)0;
+    }
+    clockTicked = TRUE;
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/* Called before CLOCK Control is read: the time now and the countdown end */
+void ClockSyncAttribute(void)
+{
+    CYBLE_GATT_HANDLE_VALUE_PAIR_T value;
+    uint32 now = clockSeconds;
+    uint8 data[CLOCK_SIZE];
+    uint8 i;
+    
+    for (i = 0; i < 4; i++)
+    {
+        data[i] = (uint8)(now >> (8 * i));
+        data[4 + i] = (uint8)(clockEnd >> (8 * i));
+    }
+    value.attrHandle = CYBLE_MESSAGE_CLOCK_CONTROL_CHAR_HANDLE;
+    value.value.val = data;
+    value.value.len = CLOCK_SIZE;
+    CyBle_GattsWriteAttributeValue(&value, 0, &cyBle_connHandle, CYBLE_GATT_DB_LOCALLY_INITIATED);
+}
+
+/* Makes 'field' a widget of 'kind', or a plain field again with CLOCK_NONE,
+* and draws it. Called from DrawWrite. */
+void ClockWidget(uint8 field, uint8 kind)
+{
+    widgetKind[field] = kind;
+    if (kind != CLOCK_NONE)
+    {
+        Show(field);
+    }
+}
+
+/*******************************************************************************
+* Function Name: ClockService
+********************************************************************************
+*
+* Summary:
+*  Called from the main loop. Once a second, draws the widgets whose minute
+*  or second has moved on, for Display_ISR to latch. Widgets belong to a
+*  drawn layout, so nothing is drawn while the panel shows anything else.
+*
+*******************************************************************************/
+void ClockService(void)
+{
+    uint8 intrStatus;
+    uint8 i;
+    
+    if (!clockTicked)
+    {
+        return;
+    }
+    clockTicked = FALSE;
+    
+    intrStatus = CyEnterCriticalSection();
+    for (i = 0; (i < FIELD_COUNT) && (displayMode == DISPLAY_MODE_DRAW); i++)
+    {
+        if ((widgetKind[i] != CLOCK_NONE) && (Unit(widgetKind[i], clockSeconds) != widgetShown[i]))
+        {
+            Show(i);
+        }
+    }
+    CyExitCriticalSection(intrStatus);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,57 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _CLOCK_H_
+#define _CLOCK_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Clock Defines
+*******************************************************************************/
+/* Time is kept by WDT counter 0, which counts the 32.768 kHz WCO the low
+* frequency clock runs from and interrupts once a second. It runs, and wakes
+* the CPU, in deep sleep, so the time needs setting only once. The time is
+* local: seconds since 1970-01-01 00:00 in the zone the client wants shown.
+*
+* CLOCK Control is [time, LE] [countdown end, LE], 4 bytes each; a write of
+* the time alone leaves the countdown as it was, and 0 stops it. Until the
+* time is set, widgets show dashes.
+*
+* A widget binds a field (Field.h) to the clock, which fills it in. Each is
+* formatted and drawn only when what it shows changes: once a minute, or
+* once a second for the ones that show seconds. */
+#define CLOCK_WDT_MATCH     32767u  // WCO counts per second, less the one clear on match takes
+#define CLOCK_WDT_IRQ       8u      // the WDT interrupt of the BLE PSoC 4
+#define CLOCK_SIZE          8       // CLOCK Control
+#define CLOCK_TEXT_SIZE     8       // the longest a widget shows
+
+#define CLOCK_NONE          0       // the field is not a widget
+#define CLOCK_HHMM          1       // 09:41
+#define CLOCK_HHMMSS        2       // 09:41:07
+#define CLOCK_DATE          3       // 18.10.26
+#define CLOCK_COUNTDOWN     4       // 02:14:59 left, or 3d 02:14 / 12d02:14 for days
+#define CLOCK_KINDS         5
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void ClockInit(void);
+uint32 ClockNow(void);
+uint8 ClockSynced(void);
+uint8 ClockFormat(uint8 kind, char *text);
+CYBLE_GATT_ERR_CODE_T ClockWrite(const uint8 *data, uint16 length);
+void ClockSyncAttribute(void);
+void ClockWidget(uint8 field, uint8 kind);
+void ClockService(void);
+
+#endif
+/* [] END OF FILE */
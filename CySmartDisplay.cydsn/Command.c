@@ -0,0 +1,540 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Command.h>
+#include <TextSource.h>
+#include <Lz.h>
+#include <Effect.h>
+#include <Gray.h>
+#include <Zone.h>
+#include <Anim.h>
+#include <Var.h>
+
+volatile uint8 commandPending = FALSE;
+
+static COMMAND_BATCH_T batch;
+static volatile uint8 commandDone = FALSE;
+static uint8 commandLocal = FALSE;      // the batch came from the schedule, nobody waits for it
+static CYBLE_GATT_ERR_CODE_T commandResult;
+static uint16 patchBytes;       // bytes the last patch batch carried
+static uint16 patchMessage;     // message length it produced, the cost of a full resend
+
+/* Resolves a patch record against a message of 'current' characters into a
+* splice of the message. Returns FALSE if the result would not fit. */
+static uint8 ResolvePatch(const uint8 *record, uint8 size, uint16 current,
+    uint8 *offset, uint8 *remove)
+{
+    uint16 length = size - CMD_PATCH_HEADER;
+    
+    *offset = (record[1] < current) ? record[1] : current;
+    *remove = record[2];
+    
+    switch (record[0])
+    {
+        case CMD_PATCH_INSERT:
+            *remove = 0;
+            break;
+            
+        case CMD_PATCH_APPEND:
+            *offset = current;
+            *remove = 0;
+            break;
+            
+        default:
+            break;
+    }
+    if (*remove > (current - *offset))
+    {
+        *remove = current - *offset;
+    }
+    
+    return ((current - *remove + length) <= MESSAGE_SIZE);
+}
+
+/* Whether a VAR record in the first 'end' bytes of the batch has 'name', so a
+* new name set twice in one batch takes only one entry */
+static uint8 VarNamedBefore(const uint8 *data, uint16 end, const uint8 *name, uint8 length)
+{
+    uint16 i = 0;
+    
+    while (i < end)
+    {
+        if ((data[i] == CMD_TLV_VAR) && (data[i + 2] == length) && (memcmp(&data[i + 3], name, length) == 0))
+        {
+            return TRUE;
+        }
+        i += 2 + data[i + 1];
+    }
+    return FALSE;
+}
+
+static CYBLE_GATT_ERR_CODE_T ParseBatch(const uint8 *data, uint16 length)
+{
+    uint16 i = 0;
+    uint8 type, size, var;
+    uint8 newVars = 0;
+    uint16 fields;
+    
+    memset(&batch, 0, sizeof(batch));
+    batch.records = data;
+    batch.length = length;
+    
+    while (i < length)
+    {
+        if ((length - i) < 2)
+        {
+            return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+        }
+        type = data[i];
+        size = data[i + 1];
+        i += 2;
+        if (size > (length - i))
+        {
+            return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+        }
+        
+        if ((type != CMD_TLV_TEXT) && (type != CMD_TLV_PATCH) && (type != CMD_TLV_PACKED) &&
+            (type != CMD_TLV_GRAY) && (type != CMD_TLV_LAYOUT) && (type != CMD_TLV_VAR) && (size != 1))
+        {
+            return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+        }
+        
+        switch (type)
+        {
+            case CMD_TLV_TEXT:
+                batch.text = (const char *)&data[i];
+                batch.textLength = size;
+                batch.fields |= CMD_FIELD_TEXT;
+                break;
+                
+            case CMD_TLV_SPEED:
+                batch.speed = data[i];
+                batch.fields |= CMD_FIELD_SPEED;
+                break;
+                
+            case CMD_TLV_BRIGHTNESS:
+                batch.brightness = data[i];
+                batch.fields |= CMD_FIELD_BRIGHTNESS;
+                break;
+                
+            case CMD_TLV_EFFECT:
+                if (data[i] >= EFFECT_COUNT)
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.effect = data[i];
+                batch.fields |= CMD_FIELD_EFFECT;
+                break;
+                
+            case CMD_TLV_PATCH:
+                if ((size < CMD_PATCH_HEADER) || (data[i] > CMD_PATCH_APPEND) ||
+                    ((data[i] == CMD_PATCH_DELETE) && (size != CMD_PATCH_HEADER)))
+                {
+                    return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+                }
+                batch.fields |= CMD_FIELD_PATCH;
+                break;
+                
+            case CMD_TLV_PACKED:
+                if (size < CMD_PACKED_HEADER)
+                {
+                    return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+                }
+                batch.packed = &data[i + CMD_PACKED_HEADER];
+                batch.packedSize = size - CMD_PACKED_HEADER;
+                batch.packedLength = data[i] | ((uint16)data[i + 1] << 8);
+                if (!LzValidate(batch.packed, batch.packedSize, batch.packedLength))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.fields |= CMD_FIELD_PACKED;
+                break;
+                
+            case CMD_TLV_GRAY:
+                if ((size < 1) || (data[i] == 0) || (data[i] > GRAY_MAX_DEPTH))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                if (size != (1 + (data[i] * FB_COLUMNS)))
+                {
+                    return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+                }
+                batch.grayDepth = data[i];
+                batch.gray = &data[i + 1];
+                batch.fields |= CMD_FIELD_GRAY;
+                break;
+                
+            case CMD_TLV_ZONE:
+                if (data[i] >= ZONE_COUNT)
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.zone = data[i];
+                batch.fields |= CMD_FIELD_ZONE;
+                break;
+                
+            case CMD_TLV_LAYOUT:
+                if (size != ZONE_COUNT)
+                {
+                    return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+                }
+                if (!ZoneLayoutValid(&data[i]))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.layout = &data[i];
+                batch.fields |= CMD_FIELD_LAYOUT;
+                break;
+                
+            case CMD_TLV_SPACING:
+                if ((data[i] > RENDER_SPACING_MAX) && (data[i] != RENDER_FIXED))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.spacing = data[i];
+                batch.fields |= CMD_FIELD_SPACING;
+                break;
+                
+            case CMD_TLV_SIZE:
+                if (!ScaleValid(data[i]))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.size = data[i];
+                batch.fields |= CMD_FIELD_SIZE;
+                break;
+                
+            case CMD_TLV_ANIM:
+                if ((data[i] > ANIM_MAX_FPS) || !AnimValid())
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.animFps = data[i];
+                batch.fields |= CMD_FIELD_ANIM;
+                break;
+                
+            case CMD_TLV_VAR:
+                if ((size < 1) || (size < (1 + data[i])) || ((size - 1 - data[i]) > VAR_VALUE_SIZE))
+                {
+                    return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+                }
+                var = VarFind((const char *)&data[i + 1], data[i], FALSE);
+                if (!VarNameValid((const char *)&data[i + 1], data[i]) || (var < VAR_BUILT_IN))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                if ((var == VAR_NONE) && !VarNamedBefore(data, i - 2, &data[i + 1], data[i]))
+                {
+                    newVars++;
+                }
+                batch.fields |= CMD_FIELD_VAR;
+                break;
+                
+            case CMD_TLV_PAGE:
+                if (data[i] == 0)
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                batch.pageHold = data[i];
+                batch.fields |= CMD_FIELD_PAGE;
+                break;
+                
+            default:
+                return CYBLE_GATT_ERR_OUT_OF_RANGE;
+        }
+        i += size;
+    }
+    
+    if (newVars > VarRoom())
+    {
+        return CYBLE_GATT_ERR_INSUFFICIENT_RESOURCE;
+    }
+    fields = batch.fields & (CMD_FIELD_TEXT | CMD_FIELD_PACKED | CMD_FIELD_GRAY | CMD_FIELD_ANIM);
+    if (fields & (fields - 1))
+    {
+        /* Two messages in one batch is ambiguous */
+        return CYBLE_GATT_ERR_OUT_OF_RANGE;
+    }
+    if ((batch.fields & CMD_FIELD_PAGE) && (batch.fields & (CMD_FIELD_GRAY | CMD_FIELD_ANIM)))
+    {
+        /* Pages are laid out from text */
+        return CYBLE_GATT_ERR_OUT_OF_RANGE;
+    }
+    if ((batch.zone != 0) &&
+        (batch.fields & (CMD_FIELD_PACKED | CMD_FIELD_PATCH | CMD_FIELD_GRAY | CMD_FIELD_ANIM | CMD_FIELD_PAGE)))
+    {
+        /* These edit MESSAGE Control or take the whole panel */
+        return CYBLE_GATT_ERR_OUT_OF_RANGE;
+    }
+    if ((batch.zone != 0) && (batch.fields & CMD_FIELD_TEXT) && (batch.textLength > ZONE_TEXT_SIZE))
+    {
+        return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+    }
+    
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/*******************************************************************************
+* Function Name: CommandWrite
+********************************************************************************
+*
+* Summary:
+*  Validates a TLV batch written to COMMAND Control and queues it for the next
+*  frame boundary. Nothing is applied unless every record in the batch is
+*  valid. The write response is held back until Display_ISR has applied the
+*  batch, so the client gets exactly one response per batch.
+*
+* Parameters:
+*  CYBLE_GATTS_WRITE_REQ_PARAM_T *wrReq: The write request from the client.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if the batch was queued, otherwise the error to send.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T CommandWrite(CYBLE_GATTS_WRITE_REQ_PARAM_T *wrReq)
+{
+    CYBLE_GATT_ERR_CODE_T gattErr;
+    
+    if (commandPending || commandDone)
+    {
+        return GATT_ERR_BUSY;
+    }
+    
+    /* Keep the batch in the attribute value so the text can be applied later */
+    gattErr = CyBle_GattsWriteAttributeValue(&wrReq->handleValPair, 0, &wrReq->connHandle, CYBLE_GATT_DB_PEER_INITIATED);
+    if (gattErr != CYBLE_GATT_ERR_NONE)
+    {
+        return gattErr;
+    }
+    
+    gattErr = ParseBatch(CYBLE_GATT_DB_ATTR_GET_ATTR_GEN_PTR(CYBLE_MESSAGE_COMMAND_CONTROL_CHAR_HANDLE),
+        wrReq->handleValPair.value.len);
+    if (gattErr == CYBLE_GATT_ERR_NONE)
+    {
+        commandPending = TRUE;
+    }
+    
+    return gattErr;
+}
+
+/* Checks a batch kept for later, such as a scheduled one, without queueing
+* it. The parse fills the one batch, so this waits while a batch is queued. */
+CYBLE_GATT_ERR_CODE_T CommandValid(const uint8 *data, uint16 length)
+{
+    if (commandPending || commandDone)
+    {
+        return GATT_ERR_BUSY;
+    }
+    return ParseBatch(data, length);
+}
+
+/* Queues a batch the device keeps itself, such as a scheduled one, for the
+* next frame boundary. No write response is sent for it. The batch must stay
+* where it is until it is applied. */
+CYBLE_GATT_ERR_CODE_T CommandSchedule(const uint8 *data, uint16 length)
+{
+    CYBLE_GATT_ERR_CODE_T gattErr = CommandValid(data, length);
+    
+    if (gattErr == CYBLE_GATT_ERR_NONE)
+    {
+        commandLocal = TRUE;
+        commandPending = TRUE;
+    }
+    return gattErr;
+}
+
+/* Applies the patch records in batch order. Every patch is checked against the
+* lengths it will see before the message is touched, so either all of them
+* are applied or none is. */
+static CYBLE_GATT_ERR_CODE_T ApplyPatches(void)
+{
+    uint16 i, length;
+    uint8 size, offset, remove;
+    
+    length = TEXT_ATTR_LENGTH(activeText);
+    
+    for (i = 0; i < batch.length; i += 2 + size)
+    {
+        size = batch.records[i + 1];
+        if (batch.records[i] == CMD_TLV_PATCH)
+        {
+            if (!ResolvePatch(&batch.records[i + 2], size, length, &offset, &remove))
+            {
+                return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+            }
+            length = length - remove + (size - CMD_PATCH_HEADER);
+        }
+    }
+    
+    length = TEXT_ATTR_LENGTH(activeText);
+    for (i = 0; i < batch.length; i += 2 + size)
+    {
+        size = batch.records[i + 1];
+        if (batch.records[i] == CMD_TLV_PATCH)
+        {
+            ResolvePatch(&batch.records[i + 2], size, length, &offset, &remove);
+            MessageSplice(offset, remove, (const char *)&batch.records[i + 2 + CMD_PATCH_HEADER],
+                size - CMD_PATCH_HEADER);
+            length = activeText->length;
+            patchBytes += 2 + size;
+        }
+    }
+    
+    patchMessage = length;
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/* Sets the variables in batch order. ParseBatch checked there was room for
+* the new names, but a message shown since may have taken it; the client is
+* then told, rather than getting a success for a value left out. */
+static CYBLE_GATT_ERR_CODE_T ApplyVars(void)
+{
+    CYBLE_GATT_ERR_CODE_T result = CYBLE_GATT_ERR_NONE;
+    const uint8 *record;
+    uint16 i;
+    uint8 size;
+    
+    for (i = 0; i < batch.length; i += 2 + size)
+    {
+        size = batch.records[i + 1];
+        record = &batch.records[i + 2];
+        if ((batch.records[i] == CMD_TLV_VAR) &&
+            !VarSet((const char *)&record[1], record[0], (const char *)&record[1 + record[0]], size - 1 - record[0]))
+        {
+            result = CYBLE_GATT_ERR_INSUFFICIENT_RESOURCE;
+        }
+    }
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: CommandApply
+********************************************************************************
+*
+* Summary:
+*  Called by Display_ISR at the start of a frame while commandPending is set.
+*  Applies every field of the queued batch before the frame is drawn, so the
+*  panel never shows an intermediate state.
+*
+*******************************************************************************/
+void CommandApply(void)
+{
+    CYBLE_GATT_ERR_CODE_T gattErr;
+    
+    commandResult = CYBLE_GATT_ERR_NONE;
+    patchBytes = 0;
+    
+    /* Before any text, so a new message shows its values from the start */
+    if (batch.fields & CMD_FIELD_VAR)
+    {
+        commandResult = ApplyVars();
+    }
+    if (batch.fields & CMD_FIELD_LAYOUT)
+    {
+        ZoneLayout(batch.layout);
+    }
+    if (batch.fields & CMD_FIELD_BRIGHTNESS)
+    {
+        DisplayBrightness(batch.brightness);
+    }
+    if (batch.fields & CMD_FIELD_SPEED)
+    {
+        ZoneSpeed(batch.zone, batch.speed);
+    }
+    if (batch.fields & CMD_FIELD_SPACING)
+    {
+        ZoneSpacing(batch.zone, batch.spacing);
+    }
+    if (batch.fields & CMD_FIELD_SIZE)
+    {
+        ZoneSize(batch.zone, batch.size);
+    }
+    if (batch.fields & CMD_FIELD_EFFECT)
+    {
+        ZoneEffect(batch.zone, batch.effect);
+    }
+    if (batch.fields & CMD_FIELD_TEXT)
+    {
+        if (batch.zone == 0)
+        {
+            DisplayMessage((char *)batch.text, batch.textLength);
+        }
+        else
+        {
+            ZoneMessage(batch.zone, batch.text, batch.textLength);
+        }
+    }
+    if (batch.fields & CMD_FIELD_PACKED)
+    {
+        DisplayPacked(batch.packed, batch.packedSize, batch.packedLength);
+    }
+    if (batch.fields & CMD_FIELD_GRAY)
+    {
+        GrayShow(batch.gray, batch.grayDepth);
+    }
+    if (batch.fields & CMD_FIELD_ANIM)
+    {
+        AnimPlay(batch.animFps);
+    }
+    if (batch.fields & CMD_FIELD_PATCH)
+    {
+        gattErr = ApplyPatches();
+        if (commandResult == CYBLE_GATT_ERR_NONE)
+        {
+            commandResult = gattErr;
+        }
+    }
+    if (batch.fields & CMD_FIELD_PAGE)
+    {
+        /* After the text and its patches, so the pages show the result */
+        DisplayPaged(batch.pageHold);
+    }
+    
+    commandPending = FALSE;
+    commandDone = !commandLocal;
+    commandLocal = FALSE;
+}
+
+/*******************************************************************************
+* Function Name: CommandService
+********************************************************************************
+*
+* Summary:
+*  Called from the main loop. Sends the write response for a batch once it has
+*  been applied, or the error if its patches did not fit the message.
+*
+*******************************************************************************/
+void CommandService(void)
+{
+    CYBLE_GATTS_ERR_PARAM_T errRsp;
+    
+    if (commandDone)
+    {
+        commandDone = FALSE;
+        if (commandResult == CYBLE_GATT_ERR_NONE)
+        {
+            CyBle_GattsWriteRsp(cyBle_connHandle);
+            if (patchBytes != 0)
+            {
+                printf("Patch: %u bytes sent, full message %u bytes\r\n", patchBytes, patchMessage);
+            }
+        }
+        else
+        {
+            errRsp.attrHandle = CYBLE_MESSAGE_COMMAND_CONTROL_CHAR_HANDLE;
+            errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+            errRsp.errorCode = commandResult;
+            CyBle_GattsErrorRsp(cyBle_connHandle, &errRsp);
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _COMMAND_H_
+#define _COMMAND_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Command TLV Defines
+*******************************************************************************/
+/* COMMAND Control carries a batch of [type] [length] [value...] records */
+#define CMD_TLV_TEXT        0x01    // message text, 0 to 178 bytes
+#define CMD_TLV_SPEED       0x02    // 1 byte, same range as SPEED Control
+#define CMD_TLV_BRIGHTNESS  0x03    // 1 byte, same range as BRIGHTNESS Control
+#define CMD_TLV_EFFECT      0x04    // 1 byte EFFECT_ id, see Effect.h
+#define CMD_TLV_ZONE        0x05    // 1 byte zone id the batch applies to, see Zone.h
+#define CMD_TLV_PATCH       0x06    // [op] [offset] [count] [text...], may repeat
+#define CMD_TLV_PACKED      0x07    // [unpacked length, 2 bytes LE] [LZ stream...], see Lz.h
+#define CMD_TLV_GRAY        0x08    // [depth] [depth planes of FB_COLUMNS bytes, LSB plane first], see Gray.h
+#define CMD_TLV_LAYOUT      0x09    // modules in each of the ZONE_COUNT zones, left to right
+#define CMD_TLV_SPACING     0x0A    // 1 byte, columns between characters or RENDER_FIXED, see Render.h
+#define CMD_TLV_SIZE        0x0B    // 1 byte SCALE_ text size, see Scale.h
+#define CMD_TLV_ANIM        0x0C    // 1 byte, play the uploaded animation at this many fps, see Anim.h
+#define CMD_TLV_VAR         0x0D    // [name length] [name] [value...], may repeat, see Var.h
+#define CMD_TLV_PAGE        0x0E    // 1 byte, show the message in pages held this many tenths of a second, see Page.h
+
+#define CMD_PATCH_REPLACE   0x00    // replace 'count' characters at offset with text
+#define CMD_PATCH_INSERT    0x01    // insert text before offset
+#define CMD_PATCH_DELETE    0x02    // delete 'count' characters at offset
+#define CMD_PATCH_APPEND    0x03    // add text at the end; offset and count ignored
+#define CMD_PATCH_HEADER    3
+#define CMD_PACKED_HEADER   2
+
+#define CMD_FIELD_TEXT          0x01
+#define CMD_FIELD_SPEED         0x02
+#define CMD_FIELD_BRIGHTNESS    0x04
+#define CMD_FIELD_EFFECT        0x08
+#define CMD_FIELD_ZONE          0x10
+#define CMD_FIELD_PATCH         0x20
+#define CMD_FIELD_PACKED        0x40
+#define CMD_FIELD_GRAY          0x80
+#define CMD_FIELD_LAYOUT        0x0100
+#define CMD_FIELD_SPACING       0x0200
+#define CMD_FIELD_SIZE          0x0400
+#define CMD_FIELD_ANIM          0x0800
+#define CMD_FIELD_VAR           0x1000
+#define CMD_FIELD_PAGE          0x2000
+
+typedef struct
+{
+    uint16 fields;          // CMD_FIELD_* present in the batch
+    const char *text;       // points into the COMMAND Control value
+    uint8 textLength;
+    uint8 speed;
+    uint8 brightness;
+    uint8 effect;
+    uint8 spacing;
+    uint8 size;
+    uint8 animFps;
+    uint8 pageHold;
+    uint8 zone;             // text, speed, spacing, size and effect apply to this zone
+    const uint8 *layout;
+    const uint8 *packed;    // LZ stream, also inside the COMMAND Control value
+    uint8 packedSize;
+    uint16 packedLength;    // characters it unpacks to
+    const uint8 *gray;      // planes, inside the COMMAND Control value
+    uint8 grayDepth;
+    const uint8 *records;   // the whole batch, walked again to apply patches in order
+    uint16 length;
+} COMMAND_BATCH_T;
+
+extern volatile uint8 commandPending;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T CommandWrite(CYBLE_GATTS_WRITE_REQ_PARAM_T *wrReq);
+CYBLE_GATT_ERR_CODE_T CommandValid(const uint8 *data, uint16 length);
+CYBLE_GATT_ERR_CODE_T CommandSchedule(const uint8 *data, uint16 length);
+void CommandApply(void);
+void CommandService(void);
+
+#endif
+/* [] END OF FILE */
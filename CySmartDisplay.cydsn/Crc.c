@@ -0,0 +1,31 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Crc.h>
+
+/* Carries 'crc' on over 'length' bytes a bit at a time: uploads are short
+* and rare, so a table is not worth its flash */
+uint16 Crc16(uint16 crc, const volatile uint8 *data, uint16 length)
+{
+    uint8 bit;
+    
+    while (length--)
+    {
+        crc ^= (uint16)(*data++) << 8;
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x8000) ? (uint16)((crc << 1) ^ 0x1021) : (uint16)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,30 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _CRC_H_
+#define _CRC_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* CRC Defines
+*******************************************************************************/
+/* Uploads kept in flash carry a CRC-16/CCITT-FALSE: polynomial 0x1021, from
+* CRC16_INIT, no reflection, no final XOR. "123456789" gives 0x29B1. */
+#define CRC16_INIT          0xFFFFu
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint16 Crc16(uint16 crc, const volatile uint8 *data, uint16 length);
+
+#endif
+/* [] END OF FILE */
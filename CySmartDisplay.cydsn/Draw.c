@@ -0,0 +1,431 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Draw.h>
+#include <Glyph.h>
+#include <Sprite.h>
+#include <Field.h>
+#include <Clock.h>
+
+/* Writes 'bits' into word 'w' of pixel row 'y' where 'mask' is set */
+static void Word(uint8 y, uint8 w, uint32 bits, uint32 mask, uint8 colour)
+{
+    switch (colour)
+    {
+        case DRAW_CLEAR:
+            bits = 0;
+            break;
+            
+        case DRAW_SET:
+            bits = 0xFFFFFFFFu;
+            break;
+            
+        case DRAW_INVERT:
+            bits = ~fbRows[y][w];
+            break;
+            
+        default:
+            break;
+    }
+    FramebufferMaskWord(y, w, mask, bits);
+}
+
+/*******************************************************************************
+* Function Name: Place
+********************************************************************************
+*
+* Summary:
+*  Draws the first 'count' pixels of 'bits', the leftmost in the MSB, into
+*  pixel row 'y' from 'x', where 'mask' is set. The pixels are clipped to the
+*  panel and land in at most two words of the row. Every primitive comes down
+*  to this.
+*
+*******************************************************************************/
+static void Place(int16 x, int16 y, uint32 bits, uint32 mask, uint8 count, uint8 colour)
+{
+    uint8 shift, w;
+    
+    if ((y < 0) || (y >= FB_HEIGHT) || (x >= FB_WIDTH) || (count == 0) || ((x + count) <= 0))
+    {
+        return;
+    }
+    if (count < 32)
+    {
+        mask &= ~(0xFFFFFFFFu >> count);
+    }
+    if (x < 0)
+    {
+        bits <<= -x;
+        mask <<= -x;
+        x = 0;
+    }
+    if ((FB_WIDTH - x) < 32)
+    {
+        mask &= ~(0xFFFFFFFFu >> (FB_WIDTH - x));
+    }
+    
+    shift = x % 32;
+    w = x / 32;
+    Word(y, w, bits >> shift, mask >> shift, colour);
+    if ((shift != 0) && ((w + 1) < FB_WORDS))
+    {
+        Word(y, w + 1, bits << (32 - shift), mask << (32 - shift), colour);
+    }
+}
+
+void DrawPixel(int16 x, int16 y, uint8 colour)
+{
+    Place(x, y, 0xFFFFFFFFu, 0xFFFFFFFFu, 1, colour);
+}
+
+void DrawHLine(int16 x, int16 y, uint8 w, uint8 colour)
+{
+    uint16 i;
+    
+    for (i = 0; i < w; i += 32)
+    {
+        Place(x + i, y, 0xFFFFFFFFu, 0xFFFFFFFFu, ((w - i) < 32) ? (w - i) : 32, colour);
+    }
+}
+
+void DrawVLine(int16 x, int16 y, uint8 h, uint8 colour)
+{
+    uint8 i;
+    
+    for (i = 0; i < h; i++)
+    {
+        Place(x, y + i, 0xFFFFFFFFu, 0xFFFFFFFFu, 1, colour);
+    }
+}
+
+void DrawRect(int16 x, int16 y, uint8 w, uint8 h, uint8 colour)
+{
+    uint8 i;
+    
+    for (i = 0; i < h; i++)
+    {
+        DrawHLine(x, y + i, w, colour);
+    }
+}
+
+/* The whole panel, which may be wider than a rectangle can be */
+static void Fill(uint8 colour)
+{
+    uint16 x;
+    uint8 y;
+    
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        for (x = 0; x < FB_WIDTH; x += 32)
+        {
+            Place(x, y, 0xFFFFFFFFu, 0xFFFFFFFFu, 32, colour);
+        }
+    }
+}
+
+/* 32 pixels of a bitmap row from pixel 'first', a multiple of 8 */
+static uint32 RowBits(const uint8 *row, uint8 stride, uint16 first)
+{
+    uint32 bits = 0;
+    uint8 b;
+    
+    for (b = first / 8; b < ((first / 8) + 4); b++)
+    {
+        bits = (bits << 8) | ((b < stride) ? row[b] : 0);
+    }
+    return bits;
+}
+
+/* Draws a w x h bitmap at (x, y). 'mask' is a bitmap of the same size whose
+* lit pixels are the ones drawn, or NULL to draw them all; passing 'bits'
+* again draws only the lit pixels. */
+void DrawBlit(int16 x, int16 y, uint8 w, uint8 h, const uint8 *bits, const uint8 *mask)
+{
+    uint8 stride = DRAW_BLIT_STRIDE(w);
+    uint16 i;
+    uint8 row;
+    
+    for (row = 0; row < h; row++)
+    {
+        for (i = 0; i < w; i += 32)
+        {
+            Place(x + i, y + row, RowBits(bits, stride, i),
+                (mask != NULL) ? RowBits(mask, stride, i) : 0xFFFFFFFFu,
+                ((w - i) < 32) ? (w - i) : 32, DRAW_COPY);
+        }
+        bits += stride;
+        if (mask != NULL)
+        {
+            mask += stride;
+        }
+    }
+}
+
+/* Draws 'count' glyph columns, bit 0 at the top, as 8 pixel rows: up to 32
+* columns are turned into a word of each row at a time */
+static void Columns(int16 x, int16 y, const volatile uint8 *columns, uint8 count, uint8 colour)
+{
+    uint32 rows[8];
+    uint8 i, n, b;
+    
+    while (count > 0)
+    {
+        n = (count < 32) ? count : 32;
+        memset(rows, 0, sizeof(rows));
+        for (i = 0; i < n; i++)
+        {
+            for (b = 0; b < 8; b++)
+            {
+                if (columns[i] & (1u << b))
+                {
+                    rows[b] |= 0x80000000u >> i;
+                }
+            }
+        }
+        for (b = 0; b < 8; b++)
+        {
+            Place(x, y + b, rows[b], rows[b], n, colour);
+        }
+        x += n;
+        columns += n;
+        count -= n;
+    }
+}
+
+/*******************************************************************************
+* Function Name: DrawText
+********************************************************************************
+*
+* Summary:
+*  Draws UTF-8 text with its top left at (x, y), the lit pixels of each glyph
+*  in 'colour' and the rest left as they are. Characters are as wide as their
+*  lit columns, DRAW_TEXT_SPACING apart, and sprites (Sprite.h) are drawn
+*  whole, as the renderer does.
+*
+* Return:
+*  The x just past the text, where more of it would go.
+*
+*******************************************************************************/
+int16 DrawText(int16 x, int16 y, const char *text, uint8 length, uint8 colour)
+{
+    const uint8 *s = (const uint8 *)text;
+    const volatile uint8 *columns;
+    uint16 code;
+    uint8 size, extent, width;
+    
+    while ((length > 0) && (x < FB_WIDTH))
+    {
+        code = Utf8Decode(s, length, &size);
+        s += size;
+        length -= size;
+        
+        columns = SpriteColumns(code, &width);
+        if (columns == NULL)
+        {
+            extent = GlyphExtent(code);
+            columns = GlyphColumns(code) + FONT_EXTENT_FIRST(extent);
+            width = FONT_EXTENT_WIDTH(extent);
+        }
+        Columns(x, y, columns, width, colour);
+        x += width + DRAW_TEXT_SPACING;
+    }
+    return x;
+}
+
+static int16 X(const uint8 *xy)
+{
+    return (int16)(xy[0] | ((uint16)xy[1] << 8));
+}
+
+static int16 Y(const uint8 *xy)
+{
+    return (int8)xy[2];
+}
+
+/*******************************************************************************
+* Function Name: Ops
+********************************************************************************
+*
+* Summary:
+*  Walks a list of DRAW Control operations, drawing them if 'apply' is set.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if every operation is whole and valid, otherwise the
+*  error to send.
+*
+*******************************************************************************/
+static CYBLE_GATT_ERR_CODE_T Ops(const uint8 *data, uint16 length, uint8 apply)
+{
+    static const uint8 sizes[] = { 2, 5, 6, 6, 7, 7, 6, 8, 3, 3 };    // each op with its fixed arguments
+    const uint8 *a;
+    uint16 i = 0;
+    uint16 size;
+    uint8 op, colour, stride;
+    
+    while (i < length)
+    {
+        op = data[i];
+        if (op > DRAW_OP_CLOCK)
+        {
+            return CYBLE_GATT_ERR_OUT_OF_RANGE;
+        }
+        size = sizes[op];
+        if (size > (length - i))
+        {
+            return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+        }
+        a = &data[i + 1];
+        
+        /* The colour, or the blit mode, is the last fixed argument but for
+        * text, which has its length after it; fields have none */
+        colour = (op == DRAW_OP_TEXT) ? a[DRAW_XY_SIZE] : a[size - 2];
+        stride = 0;
+        switch (op)
+        {
+            case DRAW_OP_BLIT:
+                if (colour > DRAW_BLIT_MASKED)
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                stride = DRAW_BLIT_STRIDE(a[3]);
+                size += ((colour == DRAW_BLIT_MASKED) ? 2 : 1) * stride * a[4];
+                break;
+                
+            case DRAW_OP_FIELD:
+                if (!FieldValid(a[DRAW_XY_SIZE], a[DRAW_XY_SIZE + 1], a[DRAW_XY_SIZE + 2], a[DRAW_XY_SIZE + 3]))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                break;
+                
+            case DRAW_OP_VALUE:
+                if (a[0] >= FIELD_COUNT)
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                size += a[1];
+                break;
+                
+            case DRAW_OP_CLOCK:
+                if ((a[0] >= FIELD_COUNT) || (a[1] >= CLOCK_KINDS))
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                break;
+                
+            case DRAW_OP_TEXT:
+                if (colour > DRAW_INVERT)
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                size += a[DRAW_XY_SIZE + 1];
+                break;
+                
+            default:
+                if (colour > DRAW_INVERT)
+                {
+                    return CYBLE_GATT_ERR_OUT_OF_RANGE;
+                }
+                break;
+        }
+        if (size > (length - i))
+        {
+            return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+        }
+        i += size;
+        if (!apply)
+        {
+            continue;
+        }
+        
+        switch (op)
+        {
+            case DRAW_OP_FILL:
+                Fill(colour);
+                break;
+                
+            case DRAW_OP_PIXEL:
+                DrawPixel(X(a), Y(a), colour);
+                break;
+                
+            case DRAW_OP_HLINE:
+                DrawHLine(X(a), Y(a), a[3], colour);
+                break;
+                
+            case DRAW_OP_VLINE:
+                DrawVLine(X(a), Y(a), a[3], colour);
+                break;
+                
+            case DRAW_OP_RECT:
+                DrawRect(X(a), Y(a), a[3], a[4], colour);
+                break;
+                
+            case DRAW_OP_BLIT:
+                DrawBlit(X(a), Y(a), a[3], a[4], &a[6],
+                    (colour == DRAW_BLIT_OPAQUE) ? NULL :
+                    (colour == DRAW_BLIT_TRANSPARENT) ? &a[6] : &a[6 + (stride * a[4])]);
+                break;
+                
+            case DRAW_OP_TEXT:
+                DrawText(X(a), Y(a), (const char *)&a[DRAW_XY_SIZE + 2], a[DRAW_XY_SIZE + 1], colour);
+                break;
+                
+            case DRAW_OP_FIELD:
+                FieldDefine(a[DRAW_XY_SIZE], X(a), Y(a), a[DRAW_XY_SIZE + 1], a[DRAW_XY_SIZE + 2], a[DRAW_XY_SIZE + 3]);
+                ClockWidget(a[DRAW_XY_SIZE], CLOCK_NONE);
+                break;
+                
+            case DRAW_OP_CLOCK:
+                ClockWidget(a[0], a[1]);
+                break;
+                
+            default:
+                FieldSet(a[0], (const char *)&a[2], a[1]);
+                break;
+        }
+    }
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/*******************************************************************************
+* Function Name: DrawWrite
+********************************************************************************
+*
+* Summary:
+*  Applies a write to DRAW Control. Like a live stream packet, it is drawn
+*  at once and latched by Display_ISR on its next tick, and the display stays
+*  on what was drawn; the first write keeps what was shown, so a dashboard
+*  usually starts with a fill. Nothing is drawn unless the whole list is
+*  valid. The drawing is done with interrupts masked, so the ISR never
+*  latches half of it.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if it was drawn, otherwise the error to send.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T DrawWrite(const uint8 *data, uint16 length)
+{
+    CYBLE_GATT_ERR_CODE_T gattErr = Ops(data, length, FALSE);
+    uint8 intrStatus;
+    
+    if (gattErr != CYBLE_GATT_ERR_NONE)
+    {
+        return gattErr;
+    }
+    
+    intrStatus = CyEnterCriticalSection();
+    displayMode = DISPLAY_MODE_DRAW;
+    Ops(data, length, TRUE);
+    CyExitCriticalSection(intrStatus);
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,68 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _DRAW_H_
+#define _DRAW_H_
+
+#include <main.h>
+#include <Framebuffer.h>
+
+/*******************************************************************************
+* Draw Defines
+*******************************************************************************/
+/* Drawing on the framebuffer in pixel coordinates, (0, 0) the top left of
+* the panel and y counting down through the rows of modules. Everything is
+* clipped to the panel, so x and y may be negative. Pixels are set a word of
+* a pixel row at a time, and only the module columns that change are marked
+* for the commit. */
+#define DRAW_CLEAR          0
+#define DRAW_SET            1
+#define DRAW_INVERT         2
+#define DRAW_COPY           3       // a blit's own pixels; not a colour on DRAW Control
+
+/* A blit is 'h' rows of (w + 7) / 8 bytes, the leftmost pixel in bit 7 */
+#define DRAW_BLIT_OPAQUE        0   // every pixel of the bitmap is drawn
+#define DRAW_BLIT_TRANSPARENT   1   // only its lit pixels are
+#define DRAW_BLIT_MASKED        2   // the pixels lit in a mask of the same size that follows it
+#define DRAW_BLIT_STRIDE(w)     (((w) + 7) / 8)
+
+#define DRAW_TEXT_SPACING   1       // columns between characters
+
+/* DRAW Control carries a list of operations, each [op] then its arguments.
+* xy is 3 bytes, [x, signed LE] [y, signed]; widths and heights are 1 byte.
+* The whole list is checked before any of it is drawn, and the panel stays
+* in draw mode until something else is shown. */
+#define DRAW_OP_FILL        0x00    // [colour], the whole panel
+#define DRAW_OP_PIXEL       0x01    // [xy] [colour]
+#define DRAW_OP_HLINE       0x02    // [xy] [w] [colour]
+#define DRAW_OP_VLINE       0x03    // [xy] [h] [colour]
+#define DRAW_OP_RECT        0x04    // [xy] [w] [h] [colour], filled
+#define DRAW_OP_BLIT        0x05    // [xy] [w] [h] [DRAW_BLIT_ mode] [rows...] [mask rows...]
+#define DRAW_OP_TEXT        0x06    // [xy] [colour] [length] [UTF-8 text...], 8 rows tall
+#define DRAW_OP_FIELD       0x07    // [xy] [id] [chars] [cell width] [FIELD_ flags], see Field.h
+#define DRAW_OP_VALUE       0x08    // [id] [length] [text...], a field's new value
+#define DRAW_OP_CLOCK       0x09    // [id] [CLOCK_ kind], the clock fills the field, see Clock.h
+#define DRAW_XY_SIZE        3
+#define DRAW_SIZE           180     // DRAW Control
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void DrawPixel(int16 x, int16 y, uint8 colour);
+void DrawHLine(int16 x, int16 y, uint8 w, uint8 colour);
+void DrawVLine(int16 x, int16 y, uint8 h, uint8 colour);
+void DrawRect(int16 x, int16 y, uint8 w, uint8 h, uint8 colour);
+void DrawBlit(int16 x, int16 y, uint8 w, uint8 h, const uint8 *bits, const uint8 *mask);
+int16 DrawText(int16 x, int16 y, const char *text, uint8 length, uint8 colour);
+CYBLE_GATT_ERR_CODE_T DrawWrite(const uint8 *data, uint16 length);
+
+#endif
+/* [] END OF FILE */
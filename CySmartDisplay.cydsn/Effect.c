@@ -0,0 +1,179 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Effect.h>
+
+#define FADE_STEPS      16      // frames to fade out, and again to fade in
+
+static uint8 Wipe(const EFFECT_STATE_T *e, const uint8 *scene, uint8 *out)
+{
+    uint16 x;
+    
+    for (x = 0; x < e->width; x++)
+    {
+        out[x] = (x <= e->step) ? scene[x] : e->from[x];
+    }
+    return (e->step + 1) < e->width;
+}
+
+/* On for half a second, counted from the first frame, then off as long */
+static uint8 Blink(const EFFECT_STATE_T *e, const uint8 *scene, uint8 *out)
+{
+    uint16 half = (e->rate / 2) + 1;
+    
+    if ((e->step / half) & 1)
+    {
+        memset(out, 0, e->width);
+    }
+    else
+    {
+        memcpy(out, scene, e->width);
+    }
+    return TRUE;
+}
+
+static uint8 VerticalScroll(const EFFECT_STATE_T *e, const uint8 *scene, uint8 *out)
+{
+    uint8 shift = e->step + 1;
+    uint16 x;
+    
+    for (x = 0; x < e->width; x++)
+    {
+        out[x] = (shift >= 8) ? scene[x] : (uint8)((e->from[x] >> shift) | (scene[x] << (8 - shift)));
+    }
+    return shift < 8;
+}
+
+static uint8 Bounce(const EFFECT_STATE_T *e, const uint8 *scene, uint8 *out)
+{
+    uint16 width = e->width;
+    uint16 left = 0;
+    uint16 right = width;
+    uint16 range, phase;
+    int16 shift;
+    uint16 x;
+    
+    /* Lit columns are [left, right) */
+    while ((left < width) && (scene[left] == 0))
+    {
+        left++;
+    }
+    while ((right > left) && (scene[right - 1] == 0))
+    {
+        right--;
+    }
+    range = left + (width - right);
+    if (range == 0)
+    {
+        memcpy(out, scene, width);
+        return TRUE;
+    }
+    
+    /* Triangle wave from flush left to flush right and back */
+    phase = e->step % (2 * range);
+    shift = (int16)((phase < range) ? phase : (2 * range) - phase) - left;
+    for (x = 0; x < width; x++)
+    {
+        out[x] = (((int16)x - shift) >= 0) && (((int16)x - shift) < (int16)width) ? scene[x - shift] : 0;
+    }
+    return TRUE;
+}
+
+static uint8 Fade(const EFFECT_STATE_T *e, const uint8 *scene, uint8 *out)
+{
+    uint16 n = e->step;
+    uint8 level;
+    
+    if (n < FADE_STEPS)
+    {
+        level = (uint8)((fbBrightness * (FADE_STEPS - 1 - n)) / (FADE_STEPS - 1));
+        if (n == (FADE_STEPS - 1))
+        {
+            /* The lowest intensity is still lit: blank the swap frame */
+            memset(out, 0, e->width);
+        }
+        else
+        {
+            memcpy(out, e->from, e->width);
+        }
+    }
+    else
+    {
+        level = (uint8)((fbBrightness * (n + 1 - FADE_STEPS)) / FADE_STEPS);
+        memcpy(out, scene, e->width);
+    }
+    
+    /* Sent in the same commit as the pixels of this frame */
+    FramebufferModuleIntensity(e->first / 8, e->width / 8, level);
+    return n < ((2 * FADE_STEPS) - 1);
+}
+
+/* Worst cases, in the order of the EFFECT_ defines */
+const EFFECT_T effects[EFFECT_COUNT] =
+{
+    { NULL,             0   },
+    { Wipe,             180 },
+    { Blink,            160 },  // includes the step division
+    { VerticalScroll,   260 },
+    { Bounce,           520 },  // two scans and a shifted copy
+    { Fade,             230 },  // includes the level division
+};
+
+/* Chooses the effect for the messages that follow in the zone. A continuous
+* effect also starts on the message being shown. */
+void EffectSelect(EFFECT_STATE_T *e, uint8 id)
+{
+    if (id < EFFECT_COUNT)
+    {
+        e->selected = id;
+        EffectStart(e);
+    }
+}
+
+/* Called whenever the zone gets a new message: snapshot it and start over */
+void EffectStart(EFFECT_STATE_T *e)
+{
+    FramebufferRead(e->first, e->from, e->width);
+    e->step = 0;
+    FramebufferModuleIntensity(e->first / 8, e->width / 8, fbBrightness);  // in case a fade was cut short
+    e->active = (effects[e->selected].frame != NULL);
+}
+
+/*******************************************************************************
+* Function Name: EffectFrame
+********************************************************************************
+*
+* Summary:
+*  Called by the zone compositor while the zone's effect is active, with what
+*  the renderer would show in the zone. Builds the zone's columns of the
+*  framebuffer through the effect's frame routine. When a transition ends the
+*  renderer takes the zone back. Only digits that differ from the last frame
+*  are latched, and a fade's intensity goes out in the same commit.
+*
+*******************************************************************************/
+void EffectFrame(EFFECT_STATE_T *e, const uint8 *scene)
+{
+    uint8 out[FB_COLUMNS];
+    
+    if (effects[e->selected].frame(e, scene, out))
+    {
+        e->step++;
+        FramebufferWrite(e->first, out, e->width);
+    }
+    else
+    {
+        e->active = FALSE;
+        FramebufferModuleIntensity(e->first / 8, e->width / 8, fbBrightness);
+        FramebufferWrite(e->first, scene, e->width);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,64 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _EFFECT_H_
+#define _EFFECT_H_
+
+#include <main.h>
+#include <Framebuffer.h>
+
+/*******************************************************************************
+* Effect Defines
+*******************************************************************************/
+/* Transitions run once when a message is set, then hand the panel back to the
+* renderer. Continuous effects stay on until another effect is selected. */
+#define EFFECT_SCROLL       0       // none: the renderer drives the zone directly
+#define EFFECT_WIPE         1       // transition: new columns replace old left to right
+#define EFFECT_BLINK        2       // continuous: whole zone on and off every half second
+#define EFFECT_VSCROLL      3       // transition: old text leaves upwards as the new one rises
+#define EFFECT_BOUNCE       4       // continuous: lit columns slide left and right within the zone
+#define EFFECT_FADE         5       // transition: intensity down to the old text, up to the new
+#define EFFECT_COUNT        6
+
+/* Each zone runs its own effect over its own columns. Zones are whole
+* modules, so a fade dims only the modules of its zone. */
+typedef struct
+{
+    uint8 selected;
+    uint8 active;
+    uint16 step;
+    uint16 first;               // zone columns in the panel
+    uint16 width;
+    uint16 rate;                // zone steps per second
+    uint8 from[FB_COLUMNS];     // the zone when the transition started
+} EFFECT_STATE_T;
+
+/* A frame routine builds the zone from what the renderer would show. It
+* returns FALSE when the effect has finished. 'cycles' is its worst case per
+* frame on the Cortex-M0, estimated from the compiled loop for a 16 column
+* zone, not counting the latches FramebufferCommit sends. */
+typedef struct
+{
+    uint8 (*frame)(const EFFECT_STATE_T *e, const uint8 *scene, uint8 *out);
+    uint16 cycles;
+} EFFECT_T;
+
+extern const EFFECT_T effects[EFFECT_COUNT];
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void EffectSelect(EFFECT_STATE_T *e, uint8 id);
+void EffectStart(EFFECT_STATE_T *e);
+void EffectFrame(EFFECT_STATE_T *e, const uint8 *scene);
+
+#endif
+/* [] END OF FILE */
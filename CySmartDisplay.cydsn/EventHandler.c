@@ -10,12 +10,19 @@
  * ========================================
 */
 #include <main.h>
+#include <LiveStream.h>
+#include <TextSource.h>
+#include <Command.h>
+#include <Ticker.h>
+#include <Sprite.h>
+#include <Anim.h>
+#include <Draw.h>
+#include <Clock.h>
+#include <Schedule.h>
 
 CYBLE_CONN_HANDLE_T connHandle;
 CYBLE_GATTS_WRITE_REQ_PARAM_T *wrReqParam;
 
-void UpdateCharacteristics(void);
-
 /*******************************************************************************
 * Function Name: StackEventHandler
 ********************************************************************************
@@ -36,6 +43,7 @@ void UpdateCharacteristics(void);
 void StackEventHandler(uint32 event, void *eventParam)
 {
     CYBLE_API_RESULT_T apiResult = CYBLE_ERROR_OK;
+    CYBLE_GATTS_ERR_PARAM_T errRsp;
     
     switch(event)
     {
@@ -98,9 +106,6 @@ void StackEventHandler(uint32 event, void *eventParam)
             printf("Device Connected\r\n");
             
             CyBle_GattcExchangeMtuReq(cyBle_connHandle, CYBLE_GATT_MTU);
-            
-            /*Copy the default settings to the GATT Attribute*/
-            UpdateCharacteristics();
             break;
 
                    
@@ -138,28 +143,125 @@ void StackEventHandler(uint32 event, void *eventParam)
 			printf("Command from Client\r\n");
             /* Extract the Write data sent by Client */
             wrReqParam = (CYBLE_GATTS_WRITE_REQ_PARAM_T *) eventParam;
+            
+            if(CYBLE_MESSAGE_COMMAND_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Queue the batch; the response is sent once it has been applied*/
+                errRsp.errorCode = CommandWrite(wrReqParam);
+                if(errRsp.errorCode != CYBLE_GATT_ERR_NONE)
+                {
+                    errRsp.attrHandle = wrReqParam->handleValPair.attrHandle;
+                    errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+                    CyBle_GattsErrorRsp(connHandle, &errRsp);
+                }
+                break;
+            }
+            
+            if(CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Append to the ticker, refusing text the ring has no room for*/
+                errRsp.errorCode = TickerWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len, FALSE);
+                if(errRsp.errorCode != CYBLE_GATT_ERR_NONE)
+                {
+                    errRsp.attrHandle = wrReqParam->handleValPair.attrHandle;
+                    errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+                    CyBle_GattsErrorRsp(connHandle, &errRsp);
+                    break;
+                }
+            }
+            
+            if(CYBLE_MESSAGE_SPRITE_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Store the sprite in flash if its checksum matches*/
+                errRsp.errorCode = SpriteWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len);
+                if(errRsp.errorCode != CYBLE_GATT_ERR_NONE)
+                {
+                    errRsp.attrHandle = wrReqParam->handleValPair.attrHandle;
+                    errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+                    CyBle_GattsErrorRsp(connHandle, &errRsp);
+                    break;
+                }
+            }
+            
+            if(CYBLE_MESSAGE_ANIMATION_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Store a row of the frame stream if its checksum matches*/
+                errRsp.errorCode = AnimWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len);
+                if(errRsp.errorCode != CYBLE_GATT_ERR_NONE)
+                {
+                    errRsp.attrHandle = wrReqParam->handleValPair.attrHandle;
+                    errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+                    CyBle_GattsErrorRsp(connHandle, &errRsp);
+                    break;
+                }
+            }
+            
+            if(CYBLE_MESSAGE_DRAW_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Draw the operations if every one of them is valid*/
+                errRsp.errorCode = DrawWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len);
+                if(errRsp.errorCode != CYBLE_GATT_ERR_NONE)
+                {
+                    errRsp.attrHandle = wrReqParam->handleValPair.attrHandle;
+                    errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+                    CyBle_GattsErrorRsp(connHandle, &errRsp);
+                    break;
+                }
+            }
+            
+            if(CYBLE_MESSAGE_CLOCK_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Set the time, and the countdown end if there is one*/
+                errRsp.errorCode = ClockWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len);
+                if(errRsp.errorCode != CYBLE_GATT_ERR_NONE)
+                {
+                    errRsp.attrHandle = wrReqParam->handleValPair.attrHandle;
+                    errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+                    CyBle_GattsErrorRsp(connHandle, &errRsp);
+                    break;
+                }
+            }
+            
+            if(CYBLE_MESSAGE_SCHEDULE_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Store the window in flash if its checksum and batch are good*/
+                errRsp.errorCode = ScheduleWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len);
+                if(errRsp.errorCode != CYBLE_GATT_ERR_NONE)
+                {
+                    errRsp.attrHandle = wrReqParam->handleValPair.attrHandle;
+                    errRsp.opcode = CYBLE_GATT_WRITE_REQ;
+                    CyBle_GattsErrorRsp(connHandle, &errRsp);
+                    break;
+                }
+            }
+            
+            if(CYBLE_MESSAGE_TICKER_CONTROL_CLIENT_CHARACTERISTIC_CONFIGURATION_DESC_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Enable or disable the backpressure notifications*/
+                CyBle_GattsWriteAttributeValue(&wrReqParam->handleValPair, 0, &connHandle, CYBLE_GATT_DB_PEER_INITIATED);
+            }
 			
 			/*If the attribute handle of the characteristic written to is equal to that of 
 			* the characteristic, then extract the data */
 			if(CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
             {
-				/*Start displaying the new message*/
+				/*Start displaying the new message; this also stores it in the GATT DB*/
                 DisplayMessage((char *)wrReqParam->handleValPair.value.val, (uint8)wrReqParam->handleValPair.value.len);
             }
             
             if(CYBLE_MESSAGE_BRIGHTNESS_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
             {
 				/*Change the brightness*/
+                CyBle_GattsWriteAttributeValue(&wrReqParam->handleValPair, 0, &connHandle, CYBLE_GATT_DB_PEER_INITIATED);
                 DisplayBrightness(wrReqParam->handleValPair.value.val[0]);
             }
             
             if(CYBLE_MESSAGE_SPEED_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
             {
 				/*Change the speed*/
+                CyBle_GattsWriteAttributeValue(&wrReqParam->handleValPair, 0, &connHandle, CYBLE_GATT_DB_PEER_INITIATED);
                 DispaySpeed(wrReqParam->handleValPair.value.val[0]);
             }
-            
-            UpdateCharacteristics();
 			
 			/* Send the response to the write request received. */
 			CyBle_GattsWriteRsp(connHandle);
@@ -167,6 +269,46 @@ void StackEventHandler(uint32 event, void *eventParam)
 			break;
             
             
+        case CYBLE_EVT_GATTS_READ_CHAR_VAL_ACCESS_REQ: // Generated before a characteristic value is read
+            if(CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_HANDLE == ((CYBLE_GATTS_CHAR_VAL_READ_REQ_T *)eventParam)->attrHandle)
+            {
+                /*Make sure the GATT DB holds the text being shown*/
+                SyncMessageAttribute();
+            }
+            if(CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE == ((CYBLE_GATTS_CHAR_VAL_READ_REQ_T *)eventParam)->attrHandle)
+            {
+                TickerSyncAttribute();
+            }
+            if(CYBLE_MESSAGE_CLOCK_CONTROL_CHAR_HANDLE == ((CYBLE_GATTS_CHAR_VAL_READ_REQ_T *)eventParam)->attrHandle)
+            {
+                ClockSyncAttribute();
+            }
+            break;
+            
+            
+        case CYBLE_EVT_GATTS_WRITE_CMD_REQ: // Generated on a write without response
+            wrReqParam = (CYBLE_GATTS_WRITE_CMD_REQ_PARAM_T *) eventParam;
+            
+            if(CYBLE_MESSAGE_FRAMEBUFFER_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*Push the streamed columns straight to the panel*/
+                LiveStreamWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len);
+            }
+            
+            if(CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*No response to refuse with, so keep as much as fits*/
+                TickerWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len, TRUE);
+            }
+            
+            if(CYBLE_MESSAGE_DRAW_CONTROL_CHAR_HANDLE == wrReqParam->handleValPair.attrHandle)
+            {
+                /*No response to refuse with; an invalid list is dropped*/
+                DrawWrite(wrReqParam->handleValPair.value.val, wrReqParam->handleValPair.value.len);
+            }
+            break;
+            
+            
     /**********************************************************
     *                       Other Events
     ***********************************************************/
@@ -175,17 +317,4 @@ void StackEventHandler(uint32 event, void *eventParam)
     }
 }
 
-void UpdateCharacteristics(void)
-{
-    /* 'message' stores MESSAGE data parameters */
-    CYBLE_GATT_HANDLE_VALUE_PAIR_T		message;
-    
-    message.attrHandle = CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_HANDLE;
-    message.value.val = (uint8 *)buffer;
-    message.value.len = strlen(buffer);
-    message.value.actualLen = strlen(buffer);
-    
-    CyBle_GattsWriteAttributeValue(&message,FALSE,&connHandle,CYBLE_GATT_DB_LOCALLY_INITIATED);
-}
-
 /* [] END OF FILE */
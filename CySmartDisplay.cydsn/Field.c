@@ -0,0 +1,105 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Field.h>
+#include <Draw.h>
+#include <Glyph.h>
+
+static FIELD_T fields[FIELD_COUNT];
+
+/* Chars 0 takes a field out of the layout */
+uint8 FieldValid(uint8 id, uint8 chars, uint8 cell, uint8 flags)
+{
+    return (id < FIELD_COUNT) && (chars <= FIELD_MAX_CHARS) && (cell != 0) && (cell <= FIELD_MAX_CELL) &&
+        (flags <= FIELD_RIGHT);
+}
+
+/* Draws character 'c' into cell 'i' of the field, replacing all of the cell */
+static void Cell(const FIELD_T *f, uint8 i, char c)
+{
+    uint8 rows[8 * DRAW_BLIT_STRIDE(FIELD_MAX_CELL)];
+    uint8 stride = DRAW_BLIT_STRIDE(f->cell);
+    uint16 code = GLYPH_RAW_BYTE | (uint8)c;
+    uint8 extent = GlyphExtent(code);
+    const uint8 *columns = GlyphColumns(code) + FONT_EXTENT_FIRST(extent);
+    uint8 width = FONT_EXTENT_WIDTH(extent);
+    uint8 x, b, left;
+    
+    if (width > f->cell)
+    {
+        width = f->cell;
+    }
+    left = (f->cell - width) / 2;
+    memset(rows, 0, sizeof(rows));
+    for (x = 0; x < width; x++)
+    {
+        for (b = 0; b < 8; b++)
+        {
+            if (columns[x] & (1u << b))
+            {
+                rows[(b * stride) + ((left + x) / 8)] |= 0x80 >> ((left + x) % 8);
+            }
+        }
+    }
+    DrawBlit(f->x + (i * f->cell), f->y, f->cell, 8, rows, NULL);
+}
+
+/* Places field 'id' in the layout, blank */
+void FieldDefine(uint8 id, int16 x, int16 y, uint8 chars, uint8 cell, uint8 flags)
+{
+    FIELD_T *f = &fields[id];
+    
+    f->x = x;
+    f->y = y;
+    f->chars = chars;
+    f->cell = cell;
+    f->flags = flags;
+    memset(f->value, ' ', FIELD_MAX_CHARS);
+    DrawRect(x, y, chars * cell, 8, DRAW_CLEAR);
+}
+
+/*******************************************************************************
+* Function Name: FieldSet
+********************************************************************************
+*
+* Summary:
+*  Shows a new value in field 'id': up to its number of characters, padded
+*  with spaces. Only the cells whose character changed are drawn again.
+*
+*******************************************************************************/
+void FieldSet(uint8 id, const char *value, uint8 length)
+{
+    FIELD_T *f = &fields[id];
+    char shown[FIELD_MAX_CHARS];
+    uint8 i;
+    
+    if (f->chars == 0)
+    {
+        return;
+    }
+    if (length > f->chars)
+    {
+        length = f->chars;
+    }
+    memset(shown, ' ', f->chars);
+    memcpy(&shown[(f->flags & FIELD_RIGHT) ? (f->chars - length) : 0], value, length);
+    
+    for (i = 0; i < f->chars; i++)
+    {
+        if (shown[i] != f->value[i])
+        {
+            Cell(f, i, shown[i]);
+            f->value[i] = shown[i];
+        }
+    }
+}
+
+/* [] END OF FILE */
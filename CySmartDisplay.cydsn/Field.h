@@ -0,0 +1,49 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _FIELD_H_
+#define _FIELD_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Field Defines
+*******************************************************************************/
+/* Fields are places in a drawn layout that show a short value, such as a
+* score or a price, and are updated by id. Each character has a cell of its
+* own, the glyph centred in it, so a new value redraws only the cells whose
+* character changed and the commit sends only the digits under them. An
+* update is drawn and latched in the write that carries it. Characters are
+* bytes, drawn from the CP437 font. */
+#define FIELD_COUNT         8
+#define FIELD_MAX_CHARS     8
+#define FIELD_MAX_CELL      16      // columns per character
+#define FIELD_RIGHT         0x01    // flag: a short value is padded on the left, as numbers are
+
+typedef struct
+{
+    int16 x;
+    int16 y;
+    uint8 chars;                    // 0 if the field is not in the layout
+    uint8 cell;
+    uint8 flags;
+    char value[FIELD_MAX_CHARS];    // as shown, padded with spaces
+} FIELD_T;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint8 FieldValid(uint8 id, uint8 chars, uint8 cell, uint8 flags);
+void FieldDefine(uint8 id, int16 x, int16 y, uint8 chars, uint8 cell, uint8 flags);
+void FieldSet(uint8 id, const char *value, uint8 length);
+
+#endif
+/* [] END OF FILE */
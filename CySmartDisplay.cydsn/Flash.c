@@ -0,0 +1,51 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Flash.h>
+
+/*******************************************************************************
+* Function Name: FlashWriteRow
+********************************************************************************
+*
+* Summary:
+*  Erases and programs the row of flash at 'row', which must be the start of
+*  a row, with FLASH_ROW_SIZE bytes of 'data'. The BLE stack times the write
+*  so it does not overlap a connection event.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if the row was written, GATT_ERR_BUSY if the stack
+*  found no room for it within FLASH_TRIES ms, or
+*  CYBLE_GATT_ERR_UNLIKELY_ERROR if the write failed.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T FlashWriteRow(const volatile uint8 *row, const uint8 *data)
+{
+    CYBLE_API_RESULT_T result;
+    uint8 tries = 0;
+    
+    for (;;)
+    {
+        result = CyBle_StoreAppData((uint8 *)data, (const uint8 *)row, FLASH_ROW_SIZE, 0);
+        if ((result != CYBLE_ERROR_FLASH_WRITE_NOT_PERMITED) || (++tries >= FLASH_TRIES))
+        {
+            break;
+        }
+        CyDelay(1);
+    }
+    
+    if (result == CYBLE_ERROR_OK)
+    {
+        return CYBLE_GATT_ERR_NONE;
+    }
+    return (result == CYBLE_ERROR_FLASH_WRITE_NOT_PERMITED) ? GATT_ERR_BUSY : CYBLE_GATT_ERR_UNLIKELY_ERROR;
+}
+
+/* [] END OF FILE */
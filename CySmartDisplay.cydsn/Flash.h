@@ -0,0 +1,44 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _FLASH_H_
+#define _FLASH_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Flash Defines
+*******************************************************************************/
+/* Data the firmware keeps over a reset is a volatile const array of whole
+* rows of flash, declared with FLASH_ALIGN and FLASH_SECTION, read in place
+* and rewritten a row at a time. A row write stalls the CPU, interrupts
+* included, for about 20 ms, so it is only done from the main loop. Being
+* volatile, reads are not folded to the zeros the array was initialized
+* with. FLASH_SECTION is the section the BLE component keeps its bonding data
+* in, which is left out of the application checksum, so rewriting a row does
+* not break it.
+*
+* Rows are written through the BLE stack, which only starts one when it will
+* not overlap a connection event. It is asked again for up to FLASH_TRIES ms;
+* if the link still leaves no room the write is refused with GATT_ERR_BUSY
+* and the client sends it again. */
+#define FLASH_ROW_SIZE      CY_FLASH_SIZEOF_ROW
+#define FLASH_ALIGN         CY_ALIGN(CY_FLASH_SIZEOF_ROW)
+#define FLASH_SECTION       CY_SECTION(".cy_checksum_exclude")
+#define FLASH_TRIES         50
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T FlashWriteRow(const volatile uint8 *row, const uint8 *data);
+
+#endif
+/* [] END OF FILE */
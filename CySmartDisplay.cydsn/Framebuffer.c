@@ -0,0 +1,413 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Framebuffer.h>
+
+/* fbDirty keeps one bit per panel column of a module, c * 8 + d being bit d
+* of module row r, column c. The commit turns each changed module's block of
+* pixels into digit registers for the way it is mounted. A latch of
+* MODULE_COUNT packets updates digit d on every module in chain order; only
+* digits that changed on some module are sent, and the others get a no-op. */
+uint32 fbRows[FB_HEIGHT][FB_WORDS];
+volatile uint8 fbDirty[PANEL_ROWS];
+
+/* Chain position and mounting of each module, row by row from the top left.
+* The reverse of the layout and the orientation flags are filled by
+* FramebufferInit. */
+const uint8 panelLayout[MODULE_COUNT] = PANEL_LAYOUT;
+const uint8 panelOrient[MODULE_COUNT] = PANEL_ORIENT;
+static uint8 chainModule[MODULE_COUNT];
+static uint8 moduleFlags[MODULE_COUNT];
+
+/* Digit registers of each module built by the commit, and which to send */
+static uint8 moduleDigits[MODULE_COUNT][8];
+static uint8 moduleDirty[MODULE_COUNT];
+
+/* Each nibble with its bits in reverse order */
+static const uint8 reverse[16] =
+{
+    0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+    0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF,
+};
+
+/* Intensity set by BRIGHTNESS Control; fades ramp between 0 and this. Each
+* module has its own intensity register, so a zone can fade alone. A new
+* intensity is sent by the next commit, ahead of that frame's pixels. */
+uint8 fbBrightness = 0;
+static uint8 intensity[MODULE_COUNT] = {0};
+static volatile uint8 intensityDirty = FALSE;
+
+void FramebufferInit(void)
+{
+    uint8 module;
+    
+    for (module = 0; module < MODULE_COUNT; module++)
+    {
+        chainModule[panelLayout[module]] = module;
+        moduleFlags[module] = OrientFlags(panelOrient[module]);
+    }
+    FramebufferClear();
+}
+
+void FramebufferClear(void)
+{
+    memset(fbRows, 0, sizeof(fbRows));
+    memset((uint8 *)fbDirty, FB_DIRTY_ALL, PANEL_ROWS);
+}
+
+/* Reads column 'px' of module row 'line' out of its eight pixel rows */
+static uint8 Column(uint8 line, uint16 px)
+{
+    const uint32 *row = &fbRows[line * 8][px / 32];
+    uint32 mask = 0x80000000u >> (px % 32);
+    uint8 bits = 0;
+    uint8 b;
+    
+    for (b = 0; b < 8; b++)
+    {
+        if (row[b * FB_WORDS] & mask)
+        {
+            bits |= (1u << b);
+        }
+    }
+    return bits;
+}
+
+/* Writes a column, returns TRUE if any pixel changed */
+static uint8 SetColumn(uint8 line, uint16 px, uint8 bits)
+{
+    uint32 *row = &fbRows[line * 8][px / 32];
+    uint32 mask = 0x80000000u >> (px % 32);
+    uint32 old, word;
+    uint8 changed = FALSE;
+    uint8 b;
+    
+    for (b = 0; b < 8; b++)
+    {
+        old = row[b * FB_WORDS];
+        word = (bits & (1u << b)) ? (old | mask) : (old & ~mask);
+        if (word != old)
+        {
+            row[b * FB_WORDS] = word;
+            changed = TRUE;
+        }
+    }
+    return changed;
+}
+
+uint8 FramebufferColumn(uint16 x)
+{
+    return (x < FB_COLUMNS) ? Column(x / FB_WIDTH, x % FB_WIDTH) : 0;
+}
+
+/* Byte 'b' of pixel row 'y': pixels 8b to 8b + 7, the leftmost in bit 7 */
+uint8 FramebufferRowByte(uint8 y, uint8 b)
+{
+    return (uint8)(fbRows[y][b / 4] >> (24 - (8 * (b % 4))));
+}
+
+/* The fbDirty bits of the module columns in 'bits', a byte of a pixel row.
+* Bit 7 is the module column 0 that fbDirty keeps in bit 0. */
+static uint8 DirtyColumns(uint8 bits)
+{
+    return reverse[bits >> 4] | (reverse[bits & 0x0F] << 4);
+}
+
+/* Flips the pixels set in 'bits' in byte 'b' of pixel row 'y' */
+void FramebufferXorByte(uint8 y, uint8 b, uint8 bits)
+{
+    fbRows[y][b / 4] ^= (uint32)bits << (24 - (8 * (b % 4)));
+    fbDirty[y / 8] |= DirtyColumns(bits);
+}
+
+/* Sets the pixels in 'mask' of word 'w' of pixel row 'y' to those of 'bits',
+* marking only the module columns that changed */
+void FramebufferMaskWord(uint8 y, uint8 w, uint32 mask, uint32 bits)
+{
+    uint32 changed = (fbRows[y][w] ^ bits) & mask;
+    
+    if (changed)
+    {
+        fbRows[y][w] ^= changed;
+        changed |= changed >> 16;
+        fbDirty[y / 8] |= DirtyColumns((uint8)(changed | (changed >> 8)));
+    }
+}
+
+/* Moves every pixel row up by one and takes in 'row', FB_WORDS words, at the
+* bottom, marking only the module columns that changed */
+void FramebufferScrollUp(const uint32 *row)
+{
+    const uint32 *next;
+    uint32 changed;
+    uint8 y, w;
+    
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        next = ((y + 1) < FB_HEIGHT) ? fbRows[y + 1] : row;
+        changed = 0;
+        for (w = 0; w < FB_WORDS; w++)
+        {
+            changed |= fbRows[y][w] ^ next[w];
+            fbRows[y][w] = next[w];
+        }
+        if (changed)
+        {
+            changed |= changed >> 16;
+            fbDirty[y / 8] |= DirtyColumns((uint8)(changed | (changed >> 8)));
+        }
+    }
+}
+
+void FramebufferWrite(uint16 offset, const uint8 *data, uint16 length)
+{
+    uint16 x;
+    uint16 px;
+    uint8 line;
+    
+    if (offset >= FB_COLUMNS)
+    {
+        return;
+    }
+    if (length > (FB_COLUMNS - offset))
+    {
+        length = FB_COLUMNS - offset;
+    }
+    
+    for (x = offset; x < (offset + length); x++)
+    {
+        line = x / FB_WIDTH;
+        px = x % FB_WIDTH;
+        if (SetColumn(line, px, *data))
+        {
+            fbDirty[line] |= (1u << (px % 8));
+        }
+        data++;
+    }
+}
+
+void FramebufferRead(uint16 offset, uint8 *data, uint16 length)
+{
+    while (length--)
+    {
+        *data++ = FramebufferColumn(offset++);
+    }
+}
+
+/* TRUE if the next commit has latches to send */
+uint8 FramebufferPending(void)
+{
+    uint8 line;
+    
+    for (line = 0; line < PANEL_ROWS; line++)
+    {
+        if (fbDirty[line])
+        {
+            return TRUE;
+        }
+    }
+    return intensityDirty;
+}
+
+/*******************************************************************************
+* Function Name: FramebufferScroll
+********************************************************************************
+*
+* Summary:
+*  Scrolls the column space left by one: each pixel row is shifted across its
+*  words, the first pixel of a module row moves to the end of the row above,
+*  and 'column' comes in at the bottom right. Rows that are blank and take in
+*  a blank pixel are skipped, so the cost follows the lit area of the panel.
+*
+*******************************************************************************/
+void FramebufferScroll(uint8 column)
+{
+    uint32 *row;
+    uint32 carry;
+    uint8 line, b, w;
+    uint8 lit;
+    
+    for (line = 0; line < PANEL_ROWS; line++)
+    {
+        lit = FALSE;
+        for (b = 0; b < 8; b++)
+        {
+            row = fbRows[(line * 8) + b];
+            if ((line + 1) < PANEL_ROWS)
+            {
+                carry = fbRows[((line + 1) * 8) + b][0] >> 31;
+            }
+            else
+            {
+                carry = (column >> b) & 1u;
+            }
+            
+            if (!carry)
+            {
+                for (w = 0; (w < FB_WORDS) && (row[w] == 0); w++)
+                {
+                }
+                if (w == FB_WORDS)
+                {
+                    continue;
+                }
+            }
+            
+            for (w = 1; w < FB_WORDS; w++)
+            {
+                row[w - 1] = (row[w - 1] << 1) | (row[w] >> 31);
+            }
+            row[FB_WORDS - 1] = (row[FB_WORDS - 1] << 1) | (carry << FB_LAST_SHIFT);
+            lit = TRUE;
+        }
+        if (lit)
+        {
+            fbDirty[line] = FB_DIRTY_ALL;
+        }
+    }
+}
+
+void FramebufferIntensity(uint8 level)
+{
+    FramebufferModuleIntensity(0, MODULE_COUNT, level);
+}
+
+/* 'module' counts row by row from the top left, as the column space does */
+void FramebufferModuleIntensity(uint8 module, uint8 count, uint8 level)
+{
+    for (; (count > 0) && (module < MODULE_COUNT); count--, module++)
+    {
+        if (level != intensity[module])
+        {
+            intensity[module] = level;
+            intensityDirty = TRUE;
+        }
+    }
+}
+
+/* The normal latch waits SPI_DELAY around the packets. The fast one holds CS
+* low only until the SCB has shifted everything out. */
+static void LatchStart(uint8 fast)
+{
+    CS_Write(LOW);
+    if (!fast)
+    {
+        CyDelayUs(SPI_DELAY);
+    }
+}
+
+static void LatchEnd(uint8 fast)
+{
+    if (fast)
+    {
+        while ((MAX7219_SpiUartGetTxBufferSize() != 0) || MAX7219_SpiIsBusBusy())
+        {
+        }
+        CS_Write(HIGH);
+    }
+    else
+    {
+        CyDelayUs(SPI_DELAY);
+        CS_Write(HIGH);
+        CyDelayUs(SPI_DELAY);
+    }
+}
+
+/* Reads a module's block of pixels and builds its digit registers */
+static void BuildModule(uint8 module)
+{
+    const uint32 *row = &fbRows[(module / PANEL_COLUMNS) * 8][((module % PANEL_COLUMNS) * 8) / 32];
+    uint8 shift = 24 - (((module % PANEL_COLUMNS) * 8) % 32);
+    uint32 top = 0;
+    uint32 bottom = 0;
+    uint8 b;
+    
+    for (b = 0; b < 4; b++)
+    {
+        top = (top << 8) | ((row[b * FB_WORDS] >> shift) & 0xFF);
+        bottom = (bottom << 8) | ((row[(b + 4) * FB_WORDS] >> shift) & 0xFF);
+    }
+    OrientBlock(moduleFlags[module], top, bottom, moduleDigits[module]);
+}
+
+static void Commit(uint8 fast)
+{
+    uint8 dirty[PANEL_ROWS];
+    uint8 any = 0;
+    uint8 digit;
+    uint8 chain;
+    uint8 module;
+    uint8 line;
+    
+    for (line = 0; line < PANEL_ROWS; line++)
+    {
+        dirty[line] = fbDirty[line];
+        fbDirty[line] = 0;
+    }
+    
+    /* Only modules in rows that changed are read back */
+    for (module = 0; module < MODULE_COUNT; module++)
+    {
+        moduleDirty[module] = OrientDirty(moduleFlags[module], dirty[module / PANEL_COLUMNS]);
+        if (moduleDirty[module])
+        {
+            BuildModule(module);
+            any |= moduleDirty[module];
+        }
+    }
+    
+    if (intensityDirty)
+    {
+        intensityDirty = FALSE;
+        LatchStart(fast);
+        for (chain = 0; chain < MODULE_COUNT; chain++)
+        {
+            SendPacketNoCS(MAX7219_REG_INTENSITY, intensity[chainModule[chain]]);
+        }
+        LatchEnd(fast);
+    }
+    
+    for (digit = 0; digit < 8; digit++)
+    {
+        if (!(any & (1u << digit)))
+        {
+            continue;
+        }
+        
+        LatchStart(fast);
+        for (chain = 0; chain < MODULE_COUNT; chain++)
+        {
+            module = chainModule[chain];
+            if (moduleDirty[module] & (1u << digit))
+            {
+                SendPacketNoCS(MAX7219_REG_DIGIT0 + digit, moduleDigits[module][digit]);
+            }
+            else
+            {
+                SendPacketNoCS(MAX7219_REG_NOOP, 0);
+            }
+        }
+        LatchEnd(fast);
+    }
+}
+
+void FramebufferCommit(void)
+{
+    Commit(FALSE);
+}
+
+/* For sub-frame timing: a full frame takes 8 latches of MODULE_COUNT packets */
+void FramebufferCommitFast(void)
+{
+    Commit(TRUE);
+}
+
+/* [] END OF FILE */
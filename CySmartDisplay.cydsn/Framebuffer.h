@@ -0,0 +1,62 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _FRAMEBUFFER_H_
+#define _FRAMEBUFFER_H_
+
+#include <main.h>
+#include <Orient.h>
+
+/*******************************************************************************
+* Framebuffer Defines
+*******************************************************************************/
+/* The panel is PANEL_ROWS rows of PANEL_COLUMNS modules, kept as one bitplane
+* of FB_HEIGHT pixel rows, each FB_WORDS words wide. The leftmost pixel of a
+* row is the MSB of its first word, so scrolling a row left is a shift across
+* its words. */
+#define FB_WIDTH        (PANEL_COLUMNS * 8)             // pixels across
+#define FB_HEIGHT       (PANEL_ROWS * 8)                // pixel rows
+#define FB_WORDS        ((FB_WIDTH + 31) / 32)          // words per pixel row
+#define FB_LAST_SHIFT   (31 - ((FB_WIDTH - 1) % 32))    // bit of the rightmost pixel in the last word
+
+/* Text is drawn in columns: one byte per column, bit 0 the top pixel. Column
+* x is column x % FB_WIDTH of module row x / FB_WIDTH, so the rows of modules
+* follow each other in one column space of FB_COLUMNS. */
+#define FB_COLUMNS      (MODULE_COUNT * 8)
+#define FB_DIRTY_ALL    0xFF                // one bit per column of a module
+
+extern uint32 fbRows[FB_HEIGHT][FB_WORDS];
+extern volatile uint8 fbDirty[PANEL_ROWS];
+extern uint8 fbBrightness;
+extern const uint8 panelLayout[MODULE_COUNT];
+extern const uint8 panelOrient[MODULE_COUNT];
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void FramebufferInit(void);
+void FramebufferClear(void);
+void FramebufferWrite(uint16 offset, const uint8 *data, uint16 length);
+void FramebufferRead(uint16 offset, uint8 *data, uint16 length);
+uint8 FramebufferColumn(uint16 x);
+uint8 FramebufferRowByte(uint8 y, uint8 b);
+void FramebufferXorByte(uint8 y, uint8 b, uint8 bits);
+void FramebufferMaskWord(uint8 y, uint8 w, uint32 mask, uint32 bits);
+uint8 FramebufferPending(void);
+void FramebufferScroll(uint8 column);
+void FramebufferScrollUp(const uint32 *row);
+void FramebufferIntensity(uint8 level);
+void FramebufferModuleIntensity(uint8 module, uint8 count, uint8 level);
+void FramebufferCommit(void);
+void FramebufferCommitFast(void);
+
+#endif
+/* [] END OF FILE */
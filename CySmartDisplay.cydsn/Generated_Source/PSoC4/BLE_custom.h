@@ -26,14 +26,23 @@
 /* Maximum supported Custom Services */
 #define CYBLE_CUSTOMS_SERVICE_COUNT                  (0x01u)
 #define CYBLE_CUSTOMC_SERVICE_COUNT                  (0x00u)
-#define CYBLE_CUSTOM_SERVICE_CHAR_COUNT              (0x03u)
-#define CYBLE_CUSTOM_SERVICE_CHAR_DESCRIPTORS_COUNT  (0x00u)
+#define CYBLE_CUSTOM_SERVICE_CHAR_COUNT              (0x0Bu)
+#define CYBLE_CUSTOM_SERVICE_CHAR_DESCRIPTORS_COUNT  (0x01u)
 
 /* Below are the indexes and handles of the defined Custom Services and their characteristics */
 #define CYBLE_MESSAGE_SERVICE_INDEX   (0x00u) /* Index of MESSAGE service in the cyBle_customs array */
 #define CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_INDEX   (0x00u) /* Index of MESSAGE Control characteristic */
 #define CYBLE_MESSAGE_SPEED_CONTROL_CHAR_INDEX   (0x01u) /* Index of SPEED Control characteristic */
 #define CYBLE_MESSAGE_BRIGHTNESS_CONTROL_CHAR_INDEX   (0x02u) /* Index of BRIGHTNESS Control characteristic */
+#define CYBLE_MESSAGE_FRAMEBUFFER_CONTROL_CHAR_INDEX   (0x03u) /* Index of FRAMEBUFFER Control characteristic */
+#define CYBLE_MESSAGE_COMMAND_CONTROL_CHAR_INDEX   (0x04u) /* Index of COMMAND Control characteristic */
+#define CYBLE_MESSAGE_TICKER_CONTROL_CHAR_INDEX   (0x05u) /* Index of TICKER Control characteristic */
+#define CYBLE_MESSAGE_TICKER_CONTROL_CLIENT_CHARACTERISTIC_CONFIGURATION_DESC_INDEX   (0x00u) /* Index of Client Characteristic Configuration descriptor */
+#define CYBLE_MESSAGE_SPRITE_CONTROL_CHAR_INDEX   (0x06u) /* Index of SPRITE Control characteristic */
+#define CYBLE_MESSAGE_ANIMATION_CONTROL_CHAR_INDEX   (0x07u) /* Index of ANIMATION Control characteristic */
+#define CYBLE_MESSAGE_DRAW_CONTROL_CHAR_INDEX   (0x08u) /* Index of DRAW Control characteristic */
+#define CYBLE_MESSAGE_CLOCK_CONTROL_CHAR_INDEX   (0x09u) /* Index of CLOCK Control characteristic */
+#define CYBLE_MESSAGE_SCHEDULE_CONTROL_CHAR_INDEX   (0x0Au) /* Index of SCHEDULE Control characteristic */
 
 
 #define CYBLE_MESSAGE_SERVICE_HANDLE   (0x000Cu) /* Handle of MESSAGE service */
@@ -43,6 +52,23 @@
 #define CYBLE_MESSAGE_SPEED_CONTROL_CHAR_HANDLE   (0x0010u) /* Handle of SPEED Control characteristic */
 #define CYBLE_MESSAGE_BRIGHTNESS_CONTROL_DECL_HANDLE   (0x0011u) /* Handle of BRIGHTNESS Control characteristic declaration */
 #define CYBLE_MESSAGE_BRIGHTNESS_CONTROL_CHAR_HANDLE   (0x0012u) /* Handle of BRIGHTNESS Control characteristic */
+#define CYBLE_MESSAGE_FRAMEBUFFER_CONTROL_DECL_HANDLE   (0x0013u) /* Handle of FRAMEBUFFER Control characteristic declaration */
+#define CYBLE_MESSAGE_FRAMEBUFFER_CONTROL_CHAR_HANDLE   (0x0014u) /* Handle of FRAMEBUFFER Control characteristic */
+#define CYBLE_MESSAGE_COMMAND_CONTROL_DECL_HANDLE   (0x0015u) /* Handle of COMMAND Control characteristic declaration */
+#define CYBLE_MESSAGE_COMMAND_CONTROL_CHAR_HANDLE   (0x0016u) /* Handle of COMMAND Control characteristic */
+#define CYBLE_MESSAGE_TICKER_CONTROL_DECL_HANDLE   (0x0017u) /* Handle of TICKER Control characteristic declaration */
+#define CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE   (0x0018u) /* Handle of TICKER Control characteristic */
+#define CYBLE_MESSAGE_TICKER_CONTROL_CLIENT_CHARACTERISTIC_CONFIGURATION_DESC_HANDLE   (0x0019u) /* Handle of Client Characteristic Configuration descriptor */
+#define CYBLE_MESSAGE_SPRITE_CONTROL_DECL_HANDLE   (0x001Au) /* Handle of SPRITE Control characteristic declaration */
+#define CYBLE_MESSAGE_SPRITE_CONTROL_CHAR_HANDLE   (0x001Bu) /* Handle of SPRITE Control characteristic */
+#define CYBLE_MESSAGE_ANIMATION_CONTROL_DECL_HANDLE   (0x001Cu) /* Handle of ANIMATION Control characteristic declaration */
+#define CYBLE_MESSAGE_ANIMATION_CONTROL_CHAR_HANDLE   (0x001Du) /* Handle of ANIMATION Control characteristic */
+#define CYBLE_MESSAGE_DRAW_CONTROL_DECL_HANDLE   (0x001Eu) /* Handle of DRAW Control characteristic declaration */
+#define CYBLE_MESSAGE_DRAW_CONTROL_CHAR_HANDLE   (0x001Fu) /* Handle of DRAW Control characteristic */
+#define CYBLE_MESSAGE_CLOCK_CONTROL_DECL_HANDLE   (0x0020u) /* Handle of CLOCK Control characteristic declaration */
+#define CYBLE_MESSAGE_CLOCK_CONTROL_CHAR_HANDLE   (0x0021u) /* Handle of CLOCK Control characteristic */
+#define CYBLE_MESSAGE_SCHEDULE_CONTROL_DECL_HANDLE   (0x0022u) /* Handle of SCHEDULE Control characteristic declaration */
+#define CYBLE_MESSAGE_SCHEDULE_CONTROL_CHAR_HANDLE   (0x0023u) /* Handle of SCHEDULE Control characteristic */
 
 
 
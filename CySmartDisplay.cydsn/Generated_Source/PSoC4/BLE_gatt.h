@@ -35,13 +35,13 @@
 
 #if(CYBLE_GATT_ROLE_SERVER)
 
-#define CYBLE_GATT_DB_INDEX_COUNT                    (0x0012u)
-#define CYBLE_GATT_DB_ATT_VAL_COUNT                  (0x0Cu)
+#define CYBLE_GATT_DB_INDEX_COUNT                    (0x0023u)
+#define CYBLE_GATT_DB_ATT_VAL_COUNT                  (0x1Du)
 #define CYBLE_GATT_DB_MAX_VALUE_LEN                  (0x00B4u)
 
 #endif /* CYBLE_GATT_ROLE_SERVER */
 
-#define CYBLE_GATT_DB_CCCD_COUNT                     (0x02u)
+#define CYBLE_GATT_DB_CCCD_COUNT                     (0x04u)
 
 #if (CYBLE_GATT_DB_CCCD_COUNT == 0u)
     #define CYBLE_GATT_DB_FLASH_CCCD_COUNT          (1u)
@@ -0,0 +1,441 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Glyph.h>
+#include <Orient.h>
+
+/* Least recently used slot goes first. Code 0 never reaches the cache, as
+* ASCII is kept as GLYPH_RAW_BYTE | byte, so it marks a free slot. */
+typedef struct
+{
+    uint16 code;
+    uint16 used;
+    uint8 columns[8];
+    uint8 extent;
+} GLYPH_SLOT_T;
+
+static GLYPH_SLOT_T cache[GLYPH_CACHE_SLOTS];
+static uint8 lastSlot;
+static uint16 clock;
+
+/*******************************************************************************
+* Function Name: Utf8Decode
+********************************************************************************
+*
+* Summary:
+*  Decodes the character at the start of 's'. A byte that does not start a
+*  well-formed sequence of up to three bytes (overlong forms and surrogates
+*  included) is one character on its own, GLYPH_RAW_BYTE | byte, so text
+*  written as CP437 still shows as it used to. Four byte sequences are read
+*  whole and come out as GLYPH_UNKNOWN.
+*
+* Parameters:
+*  s:       The bytes, 'length' of them available.
+*  size:    Receives the bytes used, or 0 if the sequence is cut off by the
+*           end of the bytes available and could still complete.
+*
+*******************************************************************************/
+uint16 Utf8Decode(const uint8 *s, uint16 length, uint8 *size)
+{
+    uint8 lead = s[0];
+    uint8 n, i;
+    uint16 code;
+    
+    if (lead < 0x80)
+    {
+        *size = 1;
+        return lead;
+    }
+    if ((lead >= 0xC2) && (lead < 0xE0))
+    {
+        n = 2;
+        code = lead & 0x1F;
+    }
+    else if ((lead >= 0xE0) && (lead < 0xF0))
+    {
+        n = 3;
+        code = lead & 0x0F;
+    }
+    else if ((lead >= 0xF0) && (lead < 0xF5))
+    {
+        n = 4;
+        code = 0;
+    }
+    else
+    {
+        *size = 1;
+        return GLYPH_RAW_BYTE | lead;
+    }
+    
+    for (i = 1; i < n; i++)
+    {
+        if (i >= length)
+        {
+            *size = 0;
+            return 0;
+        }
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *size = 1;
+            return GLYPH_RAW_BYTE | lead;
+        }
+        code = (code << 6) | (s[i] & 0x3F);
+    }
+    
+    if (((n == 3) && ((code < 0x800) || ((code & 0xF800) == 0xD800))) ||
+        ((n == 4) && ((lead == 0xF0) ? (s[1] < 0x90) : ((lead == 0xF4) && (s[1] >= 0x90)))))
+    {
+        *size = 1;
+        return GLYPH_RAW_BYTE | lead;
+    }
+    *size = n;
+    return (n == 4) ? GLYPH_UNKNOWN : code;
+}
+
+/* Characters in a text, as the renderer steps through them */
+uint16 Utf8Count(const char *s, uint16 length)
+{
+    uint16 offset = 0;
+    uint16 count = 0;
+    uint8 size;
+    
+    while (offset < length)
+    {
+        Utf8Decode((const uint8 *)&s[offset], length - offset, &size);
+        offset += size ? size : 1;
+        count++;
+    }
+    return count;
+}
+
+/* The length of a text without a sequence cut off at its end, for text that
+* was truncated to fit */
+uint16 Utf8Trim(const char *s, uint16 length)
+{
+    uint16 start = length;
+    uint8 size;
+    
+    /* A sequence starts at most three bytes back */
+    while ((start > 0) && ((length - start) < 3) && ((s[start - 1] & 0xC0) == 0x80))
+    {
+        start--;
+    }
+    if (start > 0)
+    {
+        Utf8Decode((const uint8 *)&s[start - 1], length - start + 1, &size);
+        if (size == 0)
+        {
+            return start - 1;
+        }
+    }
+    return length;
+}
+
+/* Presses rows 0-6 of a capital into rows 2-6: rows 0 and 1 and rows 3 and 4
+* are merged, which keeps the crossbars of A, E, H and the like */
+static uint8 Squash(uint8 c)
+{
+    return (uint8)((((c | (c >> 1)) & 0x01) << 2) | ((c & 0x04) << 1) |
+        ((((c >> 3) | (c >> 4)) & 0x01) << 4) | (c & 0xE0));
+}
+
+static const GLYPH_ENTRY_T *Find(uint16 code)
+{
+    uint16 low = 0;
+    uint16 high = glyphStoreCount;
+    uint16 mid;
+    
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        if (glyphStore[mid].code == code)
+        {
+            return &glyphStore[mid];
+        }
+        if (glyphStore[mid].code < code)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return NULL;
+}
+
+/* The font CP437 bytes and the bases of composed glyphs come from */
+static const FONT_T *glyphFont = &font;
+
+/* Index of byte 'c' in the font, or -1 if the font left it out */
+static int16 FontIndex(uint8 c)
+{
+    const FONT_T *f = glyphFont;
+    
+    if ((c < f->first) || ((c - f->first) >= f->count) ||
+        ((f->extents != NULL) && (f->extents[c - f->first] == FONT_EXTENT_NONE)))
+    {
+        return -1;
+    }
+    return c - f->first;
+}
+
+/* The columns of byte 'c' as they are stored, if the font keeps them the way
+* they are drawn: a byte per column and not packed */
+static const uint8 *FontDirect(uint8 c)
+{
+    int16 index = FontIndex(c);
+    
+    if ((index < 0) || (glyphFont->format & (FONT_ROW_MAJOR | FONT_PACKED)))
+    {
+        return NULL;
+    }
+    return &glyphFont->glyphs[index * 8];
+}
+
+/* A packed glyph: from the start of its block, step over the glyphs before it */
+static const uint8 *FontPacked(uint8 index)
+{
+    const FONT_T *f = glyphFont;
+    const uint8 *p = &f->glyphs[f->blocks[index >> 4]];
+    uint8 i;
+    
+    for (i = index & 0xF0; i < index; i++)
+    {
+        p += (f->format & FONT_ROW_MAJOR) ? (1 + FONT_EXTENT_WIDTH(p[0])) : FONT_EXTENT_WIDTH(f->extents[i]);
+    }
+    return p;
+}
+
+/* Decodes byte 'c' of the font into 8 columns; FALSE if the font left it out.
+* A row-major glyph is turned the way an upright module's block is. */
+static uint8 FontGlyph(uint8 c, uint8 *columns)
+{
+    const FONT_T *f = glyphFont;
+    int16 index = FontIndex(c);
+    const uint8 *p;
+    uint8 rows[8];
+    uint8 extent;
+    
+    if (index < 0)
+    {
+        return FALSE;
+    }
+    if (!(f->format & FONT_PACKED))
+    {
+        p = &f->glyphs[index * 8];
+        memcpy((f->format & FONT_ROW_MAJOR) ? rows : columns, p, 8);
+    }
+    else if (f->format & FONT_ROW_MAJOR)
+    {
+        p = FontPacked((uint8)index);
+        memset(rows, 0, 8);
+        memcpy(&rows[FONT_EXTENT_FIRST(p[0])], &p[1], FONT_EXTENT_WIDTH(p[0]));
+    }
+    else
+    {
+        p = FontPacked((uint8)index);
+        extent = f->extents[index];
+        memset(columns, 0, 8);
+        memcpy(&columns[FONT_EXTENT_FIRST(extent)], p, FONT_EXTENT_WIDTH(extent));
+    }
+    
+    if (f->format & FONT_ROW_MAJOR)
+    {
+        OrientBlock(OrientFlags(MODULE_ROT_0),
+            ((uint32)rows[0] << 24) | ((uint32)rows[1] << 16) | ((uint32)rows[2] << 8) | rows[3],
+            ((uint32)rows[4] << 24) | ((uint32)rows[5] << 16) | ((uint32)rows[6] << 8) | rows[7], columns);
+    }
+    return TRUE;
+}
+
+/* The extent of byte 'c', or of the glyph drawn for it if the font left it out */
+static uint8 FontExtent(uint8 c)
+{
+    int16 index = FontIndex(c);
+    
+    if ((index < 0) && (c != GLYPH_MISSING))
+    {
+        return FontExtent(GLYPH_MISSING);
+    }
+    if ((index < 0) || !(glyphFont->format & FONT_PROPORTIONAL) || (glyphFont->extents == NULL))
+    {
+        return 0x08;
+    }
+    return glyphFont->extents[index];
+}
+
+/* Works out the extent of a composed glyph the way fontc does for the font */
+static uint8 Extent(const uint8 *columns)
+{
+    uint8 first = 0;
+    uint8 last = 7;
+    
+    while ((first < 8) && (columns[first] == 0))
+    {
+        first++;
+    }
+    if (first == 8)
+    {
+        return FONT_SPACE_WIDTH;
+    }
+    while (columns[last] == 0)
+    {
+        last--;
+    }
+    return (uint8)((first << 4) | (last - first + 1));
+}
+
+/* Builds the glyph and returns its extent. A font glyph reused as it is keeps
+* its extent, so the block glyphs still join up. What the font does not have
+* is drawn as GLYPH_MISSING, or blank if that is missing too. */
+static uint8 Build(uint16 code, uint8 *columns)
+{
+    const GLYPH_ENTRY_T *entry = NULL;
+    uint8 base[8];
+    const uint8 *mark;
+    uint8 c;
+    
+    if ((code & 0xFF00) == GLYPH_RAW_BYTE)
+    {
+        if (!FontGlyph((uint8)code, columns) && !FontGlyph(GLYPH_MISSING, columns))
+        {
+            memset(columns, 0, 8);
+        }
+        return FontExtent((uint8)code);
+    }
+    
+    entry = Find(code);
+    if (entry == NULL)
+    {
+        return Build(GLYPH_RAW_BYTE | GLYPH_MISSING, columns);
+    }
+    if (entry->mark & GLYPH_EXTRA)
+    {
+        memcpy(base, glyphExtra[entry->base], 8);
+    }
+    else if (!FontGlyph(entry->base, base))
+    {
+        return Build(GLYPH_RAW_BYTE | GLYPH_MISSING, columns);
+    }
+    mark = glyphMarks[entry->mark & GLYPH_MARK_MASK];
+    for (c = 0; c < 8; c++)
+    {
+        columns[c] = ((entry->mark & GLYPH_SQUASH) ? Squash(base[c]) : base[c]) | mark[c];
+    }
+    return (entry->mark == GLYPH_MARK_NONE) ? FontExtent(entry->base) : Extent(columns);
+}
+
+/*******************************************************************************
+* Function Name: GlyphColumns
+********************************************************************************
+*
+* Summary:
+*  Returns the 8 columns of a character, one byte per column, bit 0 at the
+*  top. ASCII and raw bytes come straight from the font if it stores them
+*  that way, at the cost of an array lookup. Anything else is found in the
+*  cache, checking the slot used last first, since a character is asked for
+*  once per column. A miss costs a binary search of glyphStore, about 9
+*  steps, and building the glyph into the least recently used slot; a font
+*  that is row-major or packed is decoded there too. The columns stay valid
+*  until the next call.
+*
+*******************************************************************************/
+const uint8 *GlyphColumns(uint16 code)
+{
+    GLYPH_SLOT_T *slot;
+    const uint8 *direct;
+    uint8 i, victim;
+    
+    if (code < 0x80)
+    {
+        code |= GLYPH_RAW_BYTE;
+    }
+    if ((code & 0xFF00) == GLYPH_RAW_BYTE)
+    {
+        direct = FontDirect((uint8)code);
+        if (direct != NULL)
+        {
+            return direct;
+        }
+    }
+    if (cache[lastSlot].code == code)
+    {
+        return cache[lastSlot].columns;
+    }
+    
+    if (++clock == 0)
+    {
+        /* Ages restart rather than wrap and evict the newest glyph */
+        for (i = 0; i < GLYPH_CACHE_SLOTS; i++)
+        {
+            cache[i].used = 0;
+        }
+        clock = 1;
+    }
+    
+    victim = 0;
+    for (i = 0; i < GLYPH_CACHE_SLOTS; i++)
+    {
+        if (cache[i].code == code)
+        {
+            break;
+        }
+        if (cache[i].used < cache[victim].used)
+        {
+            victim = i;
+        }
+    }
+    if (i == GLYPH_CACHE_SLOTS)
+    {
+        i = victim;
+        cache[i].extent = Build(code, cache[i].columns);
+        cache[i].code = code;
+    }
+    
+    slot = &cache[i];
+    slot->used = clock;
+    lastSlot = i;
+    return slot->columns;
+}
+
+/*******************************************************************************
+* Function Name: GlyphExtent
+********************************************************************************
+*
+* Summary:
+*  Returns the columns of a character that proportional text shows, as
+*  (first << 4) | count (FONT_EXTENT_FIRST and FONT_EXTENT_WIDTH). ASCII and
+*  raw bytes read the font's extents; anything else is brought into the cache
+*  like GlyphColumns, whose extent was worked out when it was built.
+*
+*******************************************************************************/
+uint8 GlyphExtent(uint16 code)
+{
+    if ((code < 0x80) || ((code & 0xFF00) == GLYPH_RAW_BYTE))
+    {
+        return FontExtent((uint8)code);
+    }
+    GlyphColumns(code);
+    return cache[lastSlot].extent;
+}
+
+/* Switches to another font, such as one of several built in; the glyphs
+* cached from the old one are dropped */
+void GlyphFont(const FONT_T *f)
+{
+    glyphFont = f;
+    memset(cache, 0, sizeof(cache));
+    lastSlot = 0;
+    clock = 0;
+}
+
+/* [] END OF FILE */
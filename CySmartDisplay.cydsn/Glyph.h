@@ -0,0 +1,78 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _GLYPH_H_
+#define _GLYPH_H_
+
+#include <main.h>
+#include <font.h>
+
+/*******************************************************************************
+* Glyph Defines
+*******************************************************************************/
+/* Text is UTF-8. ASCII is drawn from the CP437 font (font.h). Other code points
+* up to U+FFFF are looked up in glyphStore (glyphs.c), sorted by code point.
+* Most entries reuse a CP437 glyph, as it is or with an accent mark drawn on
+* it, so a letter costs 4 bytes of flash instead of 8. The few shapes CP437
+* has nothing close to are in glyphExtra. A glyph built from the store is
+* kept in a small RAM cache, so a character costs one store lookup however
+* many columns it scrolls through; so is a font glyph that has to be decoded. Each glyph also has an extent, the columns
+* proportional text shows (font.h). */
+#define GLYPH_CACHE_SLOTS   8       // glyphs built or decoded, kept in RAM
+#define GLYPH_RAW_BYTE      0xDC00  // | byte: a byte that is not UTF-8, drawn as its CP437 glyph
+#define GLYPH_UNKNOWN       0xFFFD  // a character beyond U+FFFF
+#define GLYPH_MISSING       '?'     // drawn for a code point with no glyph
+
+/* glyphStore mark byte: the accent drawn on the base glyph, and flags */
+#define GLYPH_MARK_NONE         0
+#define GLYPH_MARK_ACUTE        1
+#define GLYPH_MARK_GRAVE        2
+#define GLYPH_MARK_CIRCUMFLEX   3
+#define GLYPH_MARK_DIAERESIS    4
+#define GLYPH_MARK_TILDE        5
+#define GLYPH_MARK_RING         6
+#define GLYPH_MARK_DOT          7
+#define GLYPH_MARK_CARON        8
+#define GLYPH_MARK_BREVE        9
+#define GLYPH_MARK_MACRON       10
+#define GLYPH_MARK_DOUBLE_ACUTE 11
+#define GLYPH_MARK_OGONEK       12
+#define GLYPH_MARK_CEDILLA      13
+#define GLYPH_MARK_APOSTROPHE   14
+#define GLYPH_MARK_COUNT        15
+#define GLYPH_MARK_MASK         0x0F
+#define GLYPH_EXTRA             0x40    // base indexes glyphExtra, not the font
+#define GLYPH_SQUASH            0x80    // base is a capital, pressed into rows 2-6 to make room for the mark
+
+typedef struct
+{
+    uint16 code;
+    uint8 base;
+    uint8 mark;
+} GLYPH_ENTRY_T;
+
+extern const uint8 glyphMarks[GLYPH_MARK_COUNT][8];
+extern const uint8 glyphExtra[][8];
+extern const GLYPH_ENTRY_T glyphStore[];
+extern const uint16 glyphStoreCount;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint16 Utf8Decode(const uint8 *s, uint16 length, uint8 *size);
+uint16 Utf8Count(const char *s, uint16 length);
+uint16 Utf8Trim(const char *s, uint16 length);
+const uint8 *GlyphColumns(uint16 code);
+uint8 GlyphExtent(uint16 code);
+void GlyphFont(const FONT_T *f);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,109 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Gray.h>
+#include <Framebuffer.h>
+
+/* Plane 0 is the least significant bit of every pixel */
+uint8 grayPlanes[GRAY_MAX_DEPTH][FB_COLUMNS];
+uint8 grayDepth = 0;
+
+static uint8 plane = 0;
+static uint8 grayTiming = FALSE;
+
+/*******************************************************************************
+* Function Name: GrayShow
+********************************************************************************
+*
+* Summary:
+*  Switches the display to a grayscale image. Called from Display_ISR through
+*  CommandApply, so the sub-frame timing starts on a frame boundary.
+*
+* Parameters:
+*  planes: depth planes of FB_COLUMNS bytes, least significant first
+*  depth:  1 to GRAY_MAX_DEPTH
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void GrayShow(const uint8 *planes, uint8 depth)
+{
+    memcpy(grayPlanes, planes, depth * FB_COLUMNS);
+    grayDepth = depth;
+    plane = 0;
+    
+    if (!grayTiming)
+    {
+        grayTiming = TRUE;
+        Timer_CLK_Stop();
+        Timer_CLK_SetDividerValue(GRAY_TIMER_DIVIDER);
+        Timer_CLK_Start();
+    }
+    displayMode = DISPLAY_MODE_GRAY;
+}
+
+/*******************************************************************************
+* Function Name: GrayTick
+********************************************************************************
+*
+* Summary:
+*  One sub-frame: latches the next plane and holds it for its weight. The
+*  period is set before the commit so the hold counts from the ISR entry.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void GrayTick(void)
+{
+    DisplayTimer_WritePeriod(((uint32)GRAY_LSB_US << plane) - 1u);
+    FramebufferWrite(0, grayPlanes[plane], FB_COLUMNS);
+    FramebufferCommitFast();
+    
+    plane++;
+    if (plane >= grayDepth)
+    {
+        plane = 0;
+    }
+}
+
+/*******************************************************************************
+* Function Name: GrayStop
+********************************************************************************
+*
+* Summary:
+*  Puts the display timer back to the scroll timing once another mode has
+*  taken over. Does nothing if grayscale timing is not running.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void GrayStop(void)
+{
+    if (!grayTiming)
+    {
+        return;
+    }
+    
+    grayTiming = FALSE;
+    DisplayTimer_WritePeriod(DisplayTimer_TC_PERIOD_VALUE);
+    DisplayBaseSpeed();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,46 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _GRAY_H_
+#define _GRAY_H_
+
+#include <main.h>
+#include <Framebuffer.h>
+
+/*******************************************************************************
+* Gray Defines
+*******************************************************************************/
+/* Grayscale by binary code modulation: plane k of the image is latched and held
+* for 2^k sub-frame units, so a pixel's brightness follows its gray value. The
+* MAX7219 has no per-pixel PWM, so every sub-frame is a full framebuffer write.
+* host/graybench reports the deepest image each chain length can refresh at
+* GRAY_MIN_REFRESH; GRAY_MAX_DEPTH is its answer for MODULE_COUNT 2. */
+#define GRAY_MAX_DEPTH      4           // planes, 16 levels
+#define GRAY_MIN_REFRESH    60          // Hz, whole image, below this it flickers
+#define GRAY_SPI_HZ         500000u     // SCBCLK 8 MHz, 16x oversampling
+#define GRAY_CS_US          4u          // CS edges and ISR entry per latch
+#define GRAY_LATCH_US       (((MODULE_COUNT * 16u * 1000000u) / GRAY_SPI_HZ) + GRAY_CS_US)
+#define GRAY_FRAME_US       (8u * GRAY_LATCH_US)
+#define GRAY_LSB_US         (2u * GRAY_FRAME_US)    // half of it left to the main loop
+#define GRAY_TIMER_DIVIDER  ((CYDEV_BCLK__HFCLK__HZ / 1000000u) - 1u)   // 1 us timer count
+
+extern uint8 grayPlanes[GRAY_MAX_DEPTH][FB_COLUMNS];
+extern uint8 grayDepth;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void GrayShow(const uint8 *planes, uint8 depth);
+void GrayTick(void);
+void GrayStop(void);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,136 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <LiveStream.h>
+#include <Framebuffer.h>
+
+LIVE_STATS_T liveStats;
+
+static uint8 nextSequence = 0;
+static uint16 windowFrames = 0;
+static uint16 windowTicks = 0;
+static volatile uint8 statsDue = FALSE;
+
+/*******************************************************************************
+* Function Name: LiveStreamWrite
+********************************************************************************
+*
+* Summary:
+*  Applies one packet written to the FRAMEBUFFER Control characteristic. The
+*  column bitmaps are copied straight into the framebuffer at the given column
+*  offset, bypassing the text renderer, and Display_ISR latches them on its
+*  next tick. The offset is 16 bits so every column of a large wall can be
+*  reached. A full frame is simply a packet with offset 0 and FB_COLUMNS
+*  bytes. The copy is made with interrupts masked, so a packet is never
+*  latched half written.
+*
+* Parameters:
+*  const uint8 *packet: [sequence] [column offset, little-endian] [column bitmaps...]
+*  uint16 length:       Number of bytes in the packet.
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void LiveStreamWrite(const uint8 *packet, uint16 length)
+{
+    uint8 intrStatus;
+    
+    if (length < LIVE_HEADER_SIZE)
+    {
+        return;
+    }
+    
+    intrStatus = CyEnterCriticalSection();
+    if (displayMode != DISPLAY_MODE_LIVE)
+    {
+        /* First packet: stop the scroll and start counting from scratch */
+        memset(&liveStats, 0, sizeof(liveStats));
+        windowFrames = 0;
+        windowTicks = 0;
+        nextSequence = packet[0];
+        displayMode = DISPLAY_MODE_LIVE;
+    }
+    
+    liveStats.packets++;
+    liveStats.dropped += (uint8)(packet[0] - nextSequence);
+    nextSequence = packet[0] + 1;
+    
+    FramebufferWrite(packet[1] | ((uint16)packet[2] << 8), &packet[LIVE_HEADER_SIZE], length - LIVE_HEADER_SIZE);
+    CyExitCriticalSection(intrStatus);
+}
+
+/*******************************************************************************
+* Function Name: LiveStreamTick
+********************************************************************************
+*
+* Summary:
+*  Called from Display_ISR while in live mode. Latches what the packets since
+*  the last tick changed as one frame, and closes the one second frame rate
+*  window using the DisplayTimer period as the time base.
+*
+*******************************************************************************/
+void LiveStreamTick(void)
+{
+    if (FramebufferPending())
+    {
+        FramebufferCommit();
+        liveStats.frames++;
+        windowFrames++;
+    }
+    if (++windowTicks >= DisplayTickRate())
+    {
+        liveStats.fps = windowFrames;
+        windowFrames = 0;
+        windowTicks = 0;
+        statsDue = TRUE;
+    }
+}
+
+/*******************************************************************************
+* Function Name: LiveStreamService
+********************************************************************************
+*
+* Summary:
+*  Called from the main loop. Publishes the live counters to the GATT database
+*  (and the debug UART) once per second so they can be read by the client.
+*
+*******************************************************************************/
+void LiveStreamService(void)
+{
+    CYBLE_GATT_HANDLE_VALUE_PAIR_T stats;
+    uint8 value[LIVE_STATS_SIZE];
+    
+    if (!statsDue)
+    {
+        return;
+    }
+    statsDue = FALSE;
+    
+    value[0] = LO8(liveStats.frames);
+    value[1] = HI8(liveStats.frames);
+    value[2] = LO8(liveStats.packets);
+    value[3] = HI8(liveStats.packets);
+    value[4] = LO8(liveStats.dropped);
+    value[5] = HI8(liveStats.dropped);
+    value[6] = LO8(liveStats.fps);
+    value[7] = HI8(liveStats.fps);
+    
+    stats.attrHandle = CYBLE_MESSAGE_FRAMEBUFFER_CONTROL_CHAR_HANDLE;
+    stats.value.val = value;
+    stats.value.len = LIVE_STATS_SIZE;
+    CyBle_GattsWriteAttributeValue(&stats, 0, &cyBle_connHandle, CYBLE_GATT_DB_LOCALLY_INITIATED);
+    
+    printf("Live: %u fps, %u frames, %u packets, %u dropped\r\n",
+        liveStats.fps, liveStats.frames, liveStats.packets, liveStats.dropped);
+}
+
+/* [] END OF FILE */
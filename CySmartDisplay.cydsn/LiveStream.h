@@ -0,0 +1,43 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _LIVESTREAM_H_
+#define _LIVESTREAM_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Live Stream Defines
+*******************************************************************************/
+#define LIVE_HEADER_SIZE    3       // [sequence] [column offset, 2 bytes LE] [column bitmaps...]
+#define LIVE_STATS_SIZE     8
+
+/* Counters exposed by reading the FRAMEBUFFER Control characteristic.
+* All fields are sent little-endian in this order. */
+typedef struct
+{
+    uint16 frames;      // frames latched to the panel since live mode started
+    uint16 packets;     // write-without-response packets received
+    uint16 dropped;     // packets lost, from gaps in the sequence number
+    uint16 fps;         // frames latched during the last second
+} LIVE_STATS_T;
+
+extern LIVE_STATS_T liveStats;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void LiveStreamWrite(const uint8 *packet, uint16 length);
+void LiveStreamTick(void);
+void LiveStreamService(void);
+
+#endif
+/* [] END OF FILE */
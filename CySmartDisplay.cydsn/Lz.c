@@ -0,0 +1,180 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Lz.h>
+
+/*******************************************************************************
+* Function Name: LzValidate
+********************************************************************************
+*
+* Summary:
+*  Checks an uploaded stream before it is shown, so the decoders never have to:
+*  every item must lie inside the 'size' bytes given, every match must point
+*  at text already unpacked and inside the window, and the stream must unpack
+*  to exactly 'length' characters.
+*
+* Return:
+*  TRUE if the stream is well formed.
+*
+*******************************************************************************/
+uint8 LzValidate(const uint8 *in, uint16 size, uint16 length)
+{
+    uint16 i = 0;
+    uint16 out = 0;
+    uint16 match;
+    uint8 offset;
+    uint8 flags = 0;
+    uint8 flagBits = 0;
+    
+    if (length > LZ_MAX_LENGTH)
+    {
+        return FALSE;
+    }
+    
+    while (out < length)
+    {
+        if (flagBits == 0)
+        {
+            if (i >= size)
+            {
+                return FALSE;
+            }
+            flags = in[i++];
+            flagBits = 8;
+        }
+        
+        if (flags & 0x01)
+        {
+            if ((i + 2) > size)
+            {
+                return FALSE;
+            }
+            offset = (in[i] & 0x7F) + 1;
+            match = ((uint16)(in[i] & 0x80) << 1) + in[i + 1] + LZ_MIN_MATCH;
+            i += 2;
+            if ((offset > out) || (match > (length - out)))
+            {
+                return FALSE;
+            }
+            out += match;
+        }
+        else
+        {
+            if (i >= size)
+            {
+                return FALSE;
+            }
+            i++;
+            out++;
+        }
+        
+        flags >>= 1;
+        flagBits--;
+    }
+    
+    return TRUE;
+}
+
+void LzStart(LZ_STATE_T *lz, const uint8 *in)
+{
+    lz->in = in;
+    lz->flagBits = 0;
+    lz->matchLeft = 0;
+    lz->head = 0;
+}
+
+/*******************************************************************************
+* Function Name: LzNext
+********************************************************************************
+*
+* Summary:
+*  Returns the next character of a validated stream. Each call does a fixed
+*  amount of work, at most reading one flag byte and one item, so it is safe to
+*  call from Display_ISR once per character as the scroll reaches it. Calling
+*  it past the unpacked length is not allowed.
+*
+*******************************************************************************/
+char LzNext(LZ_STATE_T *lz)
+{
+    char c;
+    
+    if (lz->matchLeft == 0)
+    {
+        if (lz->flagBits == 0)
+        {
+            lz->flags = *lz->in++;
+            lz->flagBits = 8;
+        }
+        lz->flagBits--;
+        
+        if (lz->flags & 0x01)
+        {
+            lz->matchOffset = (lz->in[0] & 0x7F) + 1;
+            lz->matchLeft = ((uint16)(lz->in[0] & 0x80) << 1) + lz->in[1] + LZ_MIN_MATCH;
+            lz->in += 2;
+        }
+        lz->flags >>= 1;
+    }
+    
+    if (lz->matchLeft != 0)
+    {
+        lz->matchLeft--;
+        c = lz->window[(uint8)(lz->head - lz->matchOffset) & (LZ_WINDOW - 1)];
+    }
+    else
+    {
+        c = (char)*lz->in++;
+    }
+    
+    lz->window[lz->head & (LZ_WINDOW - 1)] = c;
+    lz->head++;
+    return c;
+}
+
+/* Unpacks the first 'length' characters of a validated stream into 'out' */
+void LzExpand(const uint8 *in, char *out, uint16 length)
+{
+    uint16 o = 0;
+    uint16 match;
+    uint8 offset;
+    uint8 flags = 0;
+    uint8 flagBits = 0;
+    
+    while (o < length)
+    {
+        if (flagBits == 0)
+        {
+            flags = *in++;
+            flagBits = 8;
+        }
+        
+        if (flags & 0x01)
+        {
+            offset = (in[0] & 0x7F) + 1;
+            match = ((uint16)(in[0] & 0x80) << 1) + in[1] + LZ_MIN_MATCH;
+            in += 2;
+            while ((match-- != 0) && (o < length))
+            {
+                out[o] = out[o - offset];
+                o++;
+            }
+        }
+        else
+        {
+            out[o++] = (char)*in++;
+        }
+        
+        flags >>= 1;
+        flagBits--;
+    }
+}
+
+/* [] END OF FILE */
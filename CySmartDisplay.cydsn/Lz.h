@@ -0,0 +1,50 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _LZ_H_
+#define _LZ_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Packed Text Defines
+*******************************************************************************/
+/* A packed stream is LZSS: a flag byte, LSB first, tells whether each of the
+* next eight items is a literal (0) or a match (1). A literal is one character.
+* A match is two bytes, [L OOOOOOO] [LLLLLLLL]: copy 3 + L characters starting
+* 1 + O characters back in the text already unpacked. */
+#define LZ_WINDOW       128     // how far back a match may reach, power of two
+#define LZ_MIN_MATCH    3
+#define LZ_MAX_MATCH    (LZ_MIN_MATCH + 511)
+#define LZ_MAX_LENGTH   4000    // unpacked characters, keeps scroll columns within an int16
+
+/* Incremental decoder: one character per call, only the window is kept */
+typedef struct
+{
+    const uint8 *in;
+    uint8 flags;
+    uint8 flagBits;             // items left in the current flag byte
+    uint8 matchOffset;
+    uint16 matchLeft;           // characters still to copy from the current match
+    uint8 head;                 // next write position in window
+    char window[LZ_WINDOW];
+} LZ_STATE_T;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint8 LzValidate(const uint8 *in, uint16 size, uint16 length);
+void LzStart(LZ_STATE_T *lz, const uint8 *in);
+char LzNext(LZ_STATE_T *lz);
+void LzExpand(const uint8 *in, char *out, uint16 length);
+
+#endif
+/* [] END OF FILE */
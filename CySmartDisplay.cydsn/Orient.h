@@ -0,0 +1,44 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _ORIENT_H_
+#define _ORIENT_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Module Orientation Defines
+*******************************************************************************/
+/* How a module is mounted, one entry per module in PANEL_ORIENT. An upright
+* module shows digit register d as panel column d, bit 0 at the top. A module
+* turned a quarter clockwise shows digit d as pixel row d. MODULE_MIRROR can be
+* added to any of them for modules wired back to front. */
+#define MODULE_ROT_0        0
+#define MODULE_ROT_90       1
+#define MODULE_ROT_180      2
+#define MODULE_ROT_270      3
+#define MODULE_MIRROR       4
+#define MODULE_ORIENTS      8
+
+/* What an orientation does to the 8 x 8 block, from OrientFlags */
+#define ORIENT_SWAP         0x01    // digits are pixel rows, not columns
+#define ORIENT_FLIP_DIGITS  0x02    // digit 0 is the last row or column
+#define ORIENT_FLIP_BITS    0x04    // bit 0 is the first pixel, stored in the MSB
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint8 OrientFlags(uint8 orient);
+void OrientBlock(uint8 flags, uint32 top, uint32 bottom, uint8 *digits);
+uint8 OrientDirty(uint8 flags, uint8 columns);
+
+#endif
+/* [] END OF FILE */
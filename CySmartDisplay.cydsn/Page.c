@@ -0,0 +1,218 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Page.h>
+#include <Glyph.h>
+#include <Sprite.h>
+
+/* The page scrolling in, or shown, as pixel rows like the framebuffer */
+static uint32 pageRows[FB_HEIGHT][FB_WORDS];
+
+static const TEXT_DESC_T *pageDesc;
+static uint16 pageNext;         // first byte of the page after the one shown
+static uint8 pageRow;           // rows of the page scrolled in, FB_HEIGHT once it is shown
+static uint8 pageHold;          // tenths of a second each page is held
+static uint16 pageTicks;        // ticks left to hold it
+static uint8 pageOnly;          // TRUE if the text is one page, which is never left
+
+/* The columns of character 'code' and how many there are */
+static const volatile uint8 *CharColumns(uint16 code, uint8 *width)
+{
+    const volatile uint8 *columns = SpriteColumns(code, width);
+    uint8 extent;
+    
+    if (columns == NULL)
+    {
+        extent = GlyphExtent(code);
+        columns = GlyphColumns(code) + FONT_EXTENT_FIRST(extent);
+        *width = FONT_EXTENT_WIDTH(extent);
+    }
+    return columns;
+}
+
+static uint16 SkipSpaces(uint16 i)
+{
+    while ((i < pageDesc->length) && (pageDesc->text[i] == ' '))
+    {
+        i++;
+    }
+    return i;
+}
+
+/*******************************************************************************
+* Function Name: PageWrap
+********************************************************************************
+*
+* Summary:
+*  Finds the line of 'text' that starts at byte 'start': as many whole words
+*  as fit in FB_WIDTH columns, ending before a space or at a '\n'. A word too
+*  wide for a line of its own is broken where the line is full, and a single
+*  character wider than the panel takes a line of its own.
+*
+* Return:
+*  The byte the line ends at, with the byte the next line starts at in 'next'
+*  and the columns the line takes in 'width'.
+*
+*******************************************************************************/
+uint16 PageWrap(const char *text, uint16 length, uint16 start, uint16 *next, uint16 *width)
+{
+    uint16 i = start;
+    uint16 used = 0;
+    uint16 brk = 0;             // the space the line would end at, if any
+    uint16 brkWidth = 0;
+    uint16 add;
+    uint8 size, w;
+    
+    while (i < length)
+    {
+        if (text[i] == '\n')
+        {
+            *next = i + 1;
+            *width = used;
+            return i;
+        }
+        if (text[i] == ' ')
+        {
+            brk = i;
+            brkWidth = used;
+        }
+        
+        CharColumns(Utf8Decode((const uint8 *)&text[i], length - i, &size), &w);
+        size = size ? size : 1;
+        add = (used != 0) ? (w + PAGE_SPACING) : w;
+        if (((used + add) > FB_WIDTH) && (i != start))
+        {
+            if (brk > start)
+            {
+                *next = brk + 1;
+                *width = brkWidth;
+                return brk;
+            }
+            *next = i;
+            *width = used;
+            return i;
+        }
+        used += add;
+        i += size;
+    }
+    *next = length;
+    *width = used;
+    return length;
+}
+
+/* Draws the characters [start, end) of the text at column x of line 'line'
+* of the page */
+static void DrawLine(uint16 start, uint16 end, uint8 line, uint16 x)
+{
+    const volatile uint8 *columns;
+    uint32 *row;
+    uint8 size, width, c, y, bits;
+    
+    while ((start < end) && (x < FB_WIDTH))
+    {
+        columns = CharColumns(Utf8Decode((const uint8 *)&pageDesc->text[start], end - start, &size), &width);
+        start += size ? size : 1;
+        for (c = 0; (c < width) && (x < FB_WIDTH); c++, x++)
+        {
+            bits = columns[c];
+            for (y = 0; bits != 0; y++, bits >>= 1)
+            {
+                if (bits & 1u)
+                {
+                    row = pageRows[(line * 8) + y];
+                    row[x / 32] |= 0x80000000ul >> (x % 32);
+                }
+            }
+        }
+        x += PAGE_SPACING;
+    }
+}
+
+/* Lays out the page that starts at byte 'start' into pageRows. Returns the
+* byte the page after it starts at. */
+static uint16 Layout(uint16 start)
+{
+    uint16 end, next, width;
+    uint8 line;
+    
+    memset(pageRows, 0, sizeof(pageRows));
+    start = SkipSpaces(start);
+    for (line = 0; (line < PAGE_LINES) && (start < pageDesc->length); line++)
+    {
+        end = PageWrap(pageDesc->text, pageDesc->length, start, &next, &width);
+        DrawLine(start, end, line, (width < FB_WIDTH) ? ((FB_WIDTH - width) / 2) : 0);
+        start = SkipSpaces(next);
+    }
+    return start;
+}
+
+/*******************************************************************************
+* Function Name: PageStart
+********************************************************************************
+*
+* Summary:
+*  Shows the text of 'desc' a page at a time, each held for 'hold' tenths of
+*  a second, from the first page. It scrolls up over what the panel showed.
+*  The text is read through the descriptor as each page is laid out, so it
+*  must not be packed. Called from Display_ISR through CommandApply.
+*
+*******************************************************************************/
+void PageStart(const TEXT_DESC_T *desc, uint8 hold)
+{
+    pageDesc = desc;
+    pageHold = hold;
+    PageRefresh();
+}
+
+/* Lays out the first page again, after the text changed */
+void PageRefresh(void)
+{
+    pageNext = Layout(0);
+    pageOnly = (pageNext >= pageDesc->length);
+    pageRow = 0;
+}
+
+/*******************************************************************************
+* Function Name: PageTick
+********************************************************************************
+*
+* Summary:
+*  Called by Display_ISR on every tick in page mode. While a page comes in
+*  the framebuffer moves up a pixel row, which costs a pass over its words.
+*  Then the page is held; at the end of the hold the next page, or the first
+*  after the last, is laid out and starts to come in.
+*
+*******************************************************************************/
+void PageTick(void)
+{
+    if (pageRow >= FB_HEIGHT)
+    {
+        if (pageOnly)
+        {
+            return;
+        }
+        if (pageTicks != 0)
+        {
+            pageTicks--;
+            return;
+        }
+        pageNext = Layout((pageNext >= pageDesc->length) ? 0 : pageNext);
+        pageRow = 0;
+    }
+    
+    FramebufferScrollUp(pageRows[pageRow]);
+    if (++pageRow >= FB_HEIGHT)
+    {
+        pageTicks = ((uint32)pageHold * DisplayTickRate()) / 10;
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,40 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _PAGE_H_
+#define _PAGE_H_
+
+#include <main.h>
+#include <Framebuffer.h>
+#include <TextSource.h>
+
+/*******************************************************************************
+* Page Defines
+*******************************************************************************/
+/* Paged text: the message is word-wrapped to the panel width, a line per row
+* of modules, and shown a page at a time. Each page is held still, then
+* scrolls up out of the panel as the next one comes in from below, a pixel
+* row per tick. Lines are centred and break at spaces or '\n'; a word wider
+* than the panel is broken where it fills a line. Markup is shown as typed,
+* and a patch to the text starts the pages over. */
+#define PAGE_LINES          PANEL_ROWS
+#define PAGE_SPACING        1       // columns between characters, as drawn text
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint16 PageWrap(const char *text, uint16 length, uint16 start, uint16 *next, uint16 *width);
+void PageStart(const TEXT_DESC_T *desc, uint8 hold);
+void PageRefresh(void);
+void PageTick(void);
+
+#endif
+/* [] END OF FILE */
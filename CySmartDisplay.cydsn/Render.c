@@ -0,0 +1,772 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Render.h>
+#include <Glyph.h>
+#include <Sprite.h>
+
+/* Tags that change the compiler state instead of emitting an op */
+#define TAG_ATTR_OFF        0xFF
+#define TAG_ATTR_ON         0xFE
+#define TAG_ALIGN           0xFD
+#define ALIGN_PENDING       0x40    // set while an alignment waits for its run
+
+static uint16 RunWidth(RENDER_T *r, uint16 start, uint16 length);
+
+/* The decoder of the one renderer showing packed text, zone 0's */
+static LZ_STATE_T packedState;
+
+/*******************************************************************************
+* Compiler
+*******************************************************************************/
+static uint8 Emit(RENDER_T *r, uint8 op, uint8 arg, uint16 start, uint16 length)
+{
+    if (r->opCount >= RENDER_MAX_OPS)
+    {
+        return FALSE;
+    }
+    r->program[r->opCount].op = op;
+    r->program[r->opCount].arg = arg;
+    r->program[r->opCount].start = start;
+    r->program[r->opCount].length = length;
+    r->opCount++;
+    return TRUE;
+}
+
+/* Emits the run of text [start, end). A pending alignment applies to the
+* first run that is not empty and only if it fits in the zone. */
+static uint8 EmitRun(RENDER_T *r, uint16 start, uint16 end, uint8 attr, uint8 *align)
+{
+    if (end <= start)
+    {
+        return TRUE;
+    }
+    if (*align && (RunWidth(r, start, end - start) <= r->width))
+    {
+        attr |= (*align & RENDER_ALIGN_MASK);
+        *align = 0;
+        return Emit(r, RENDER_OP_STATIC, attr, start, end - start);
+    }
+    *align = 0;
+    return Emit(r, RENDER_OP_TEXT, attr, start, end - start);
+}
+
+/* Parses the tag starting at text[i], which is '<'. Returns the length of the
+* tag including both brackets, or 0 if it is not one, and the op or attribute
+* change it stands for. */
+static uint8 ParseTag(const char *text, uint16 i, uint16 length, uint8 *op, uint8 *value)
+{
+    uint16 j = i + 1;
+    uint16 n = 0;
+    uint8 digits = 0;
+    char name;
+    
+    if (j >= length)
+    {
+        return 0;
+    }
+    name = text[j++];
+    if (name == '/')
+    {
+        if (((j + 1) >= length) || (text[j + 1] != '>'))
+        {
+            return 0;
+        }
+        *op = TAG_ATTR_OFF;
+        *value = (text[j] == 'b') ? RENDER_ATTR_BLINK : (text[j] == 'i') ? RENDER_ATTR_INVERSE : 0;
+        return *value ? 4 : 0;
+    }
+    
+    while ((j < length) && (text[j] >= '0') && (text[j] <= '9') && (digits < 3))
+    {
+        n = (n * 10) + (text[j++] - '0');
+        digits++;
+    }
+    if ((j >= length) || (text[j] != '>') || (n > 255))
+    {
+        return 0;
+    }
+    
+    *value = (uint8)n;
+    switch (name)
+    {
+        case 'p': *op = RENDER_OP_PAUSE; break;
+        case 's': *op = RENDER_OP_SPEED; break;
+        case 'b': *op = TAG_ATTR_ON; *value = RENDER_ATTR_BLINK; break;
+        case 'i': *op = TAG_ATTR_ON; *value = RENDER_ATTR_INVERSE; break;
+        case 'l': *op = TAG_ALIGN; *value = RENDER_ALIGN_LEFT | ALIGN_PENDING; break;
+        case 'c': *op = TAG_ALIGN; *value = RENDER_ALIGN_CENTER | ALIGN_PENDING; break;
+        case 'r': *op = TAG_ALIGN; *value = RENDER_ALIGN_RIGHT | ALIGN_PENDING; break;
+        default: return 0;
+    }
+    if ((digits != 0) != ((*op == RENDER_OP_PAUSE) || (*op == RENDER_OP_SPEED)))
+    {
+        return 0;
+    }
+    return (uint8)(j - i + 1);
+}
+
+/* Parses the variable reference starting at text[i], which is '{'. Returns
+* its length including both braces, or 0 if it is not one, and its entry. */
+static uint8 ParseVar(const char *text, uint16 i, uint16 length, uint8 *id)
+{
+    uint16 j = i + 1;
+    
+    while ((j < length) && (text[j] != '}') && ((j - i) <= VAR_NAME_SIZE))
+    {
+        j++;
+    }
+    if ((j >= length) || (text[j] != '}'))
+    {
+        return 0;
+    }
+    *id = VarFind(&text[i + 1], (uint8)(j - i - 1), TRUE);
+    return (*id != VAR_NONE) ? (uint8)(j - i + 1) : 0;
+}
+
+/* Tags are ASCII, so they are found in the bytes; 'c' counts the characters
+* up to byte 'i' for the ops */
+static uint8 Compile(RENDER_T *r, const TEXT_DESC_T *text)
+{
+    const char *s = text->text;
+    uint16 i = 0;
+    uint16 c = 0;
+    uint16 start = 0;
+    uint8 attr = 0;
+    uint8 align = 0;
+    uint8 op, value, size;
+    
+    r->opCount = 0;
+    r->plain = TRUE;
+    
+    while (i < text->length)
+    {
+        if ((s[i] != '<') && (s[i] != '{'))
+        {
+            Utf8Decode((const uint8 *)&s[i], text->length - i, &size);
+            i += size ? size : 1;
+            c++;
+            continue;
+        }
+        if (((i + 1) < text->length) && (s[i + 1] == s[i]))
+        {
+            /* Keep the first '<' or '{' in the run, drop the second */
+            if (!EmitRun(r, start, c + 1, attr, &align))
+            {
+                return FALSE;
+            }
+            i += 2;
+            c += 2;
+            start = c;
+            r->plain = FALSE;
+            continue;
+        }
+        
+        if (s[i] == '{')
+        {
+            size = ParseVar(s, i, text->length, &value);
+            if (size == 0)
+            {
+                i++;
+                c++;
+                continue;
+            }
+            /* A pending alignment makes the variable a still run of its own */
+            if (!EmitRun(r, start, c, attr, &align) ||
+                !Emit(r, align ? RENDER_OP_VAR_STILL : RENDER_OP_VAR, attr | (align & RENDER_ALIGN_MASK), value, 0))
+            {
+                return FALSE;
+            }
+            VarRefer(value);
+            align = 0;
+            i += size;
+            c += size;
+            start = c;
+            r->plain = FALSE;
+            continue;
+        }
+        
+        size = ParseTag(s, i, text->length, &op, &value);
+        if (size == 0)
+        {
+            i++;
+            c++;
+            continue;
+        }
+        if (!EmitRun(r, start, c, attr, &align))
+        {
+            return FALSE;
+        }
+        i += size;
+        c += size;
+        start = c;
+        r->plain = FALSE;
+        
+        switch (op)
+        {
+            case TAG_ATTR_OFF: attr &= ~value; break;
+            case TAG_ATTR_ON: attr |= value; break;
+            case TAG_ALIGN: align = value; break;
+            default:
+                if (!Emit(r, op, value, 0, 0))
+                {
+                    return FALSE;
+                }
+                break;
+        }
+    }
+    
+    return EmitRun(r, start, c, attr, &align) && Emit(r, RENDER_OP_END, 0, 0, 0);
+}
+
+/*******************************************************************************
+* Executor
+*******************************************************************************/
+static char PackedChar(RENDER_T *r, uint16 index)
+{
+    if ((index + 1) < r->packedIndex)
+    {
+        LzStart(&packedState, (const uint8 *)r->source->text);
+        r->packedIndex = 0;
+    }
+    while (r->packedIndex <= index)
+    {
+        r->packedChar = LzNext(&packedState);
+        r->packedIndex++;
+    }
+    return r->packedChar;
+}
+
+/* Copies the value of variable 'id' for the executor to read characters
+* from until it is done with it. Returns the characters it has. */
+static uint8 VarFetch(RENDER_T *r, uint8 id)
+{
+    r->varLength = VarValue(id, r->varText);
+    r->varVersion = VarVersion(id);
+    r->varRead = 0;
+    r->varNext = 0;
+    r->inVar = TRUE;
+    return (uint8)Utf8Count(r->varText, r->varLength);
+}
+
+/* The same as TextChar for the copy of a variable */
+static uint16 VarChar(RENDER_T *r, uint16 index)
+{
+    uint8 size;
+    
+    if ((index + 1) < r->varRead)
+    {
+        r->varRead = 0;
+        r->varNext = 0;
+    }
+    while ((r->varRead <= index) && (r->varNext < r->varLength))
+    {
+        r->varCode = Utf8Decode((const uint8 *)&r->varText[r->varNext], r->varLength - r->varNext, &size);
+        if (size == 0)
+        {
+            r->varCode = GLYPH_RAW_BYTE | (uint8)r->varText[r->varNext];
+            size = 1;
+        }
+        r->varNext += size;
+        r->varRead++;
+    }
+    return r->varCode;
+}
+
+/* Decodes character 'index' of the text. Steps forward from the last one
+* decoded, and starts over from the beginning to go back. */
+static uint16 TextChar(RENDER_T *r, uint16 index)
+{
+    const TEXT_DESC_T *text = r->source;
+    uint8 bytes[4];
+    uint8 n, size;
+    
+    if (r->inVar)
+    {
+        return VarChar(r, index);
+    }
+    if ((index + 1) < r->charsRead)
+    {
+        r->charsRead = 0;
+        r->charNext = 0;
+    }
+    while ((r->charsRead <= index) && (r->charNext < text->length))
+    {
+        if (text->source == TEXT_SOURCE_PACKED)
+        {
+            for (n = 0; (n < 4) && ((r->charNext + n) < text->length); n++)
+            {
+                bytes[n] = PackedChar(r, r->charNext + n);
+            }
+            r->charCode = Utf8Decode(bytes, n, &size);
+        }
+        else
+        {
+            r->charCode = Utf8Decode((const uint8 *)&text->text[r->charNext], text->length - r->charNext, &size);
+        }
+        if (size == 0)
+        {
+            /* Cut off by the end of the text */
+            r->charCode = GLYPH_RAW_BYTE | (uint8)text->text[r->charNext];
+            size = 1;
+        }
+        r->charNext += size;
+        r->charsRead++;
+    }
+    return r->charCode;
+}
+
+/* TRUE once every byte of the text has been shown. A packed text's op counts
+* bytes, as its characters are not known until it is unpacked. */
+static uint8 TextShown(const RENDER_T *r)
+{
+    return r->inVar ? (r->varNext >= r->varLength) : (r->charNext >= r->source->length);
+}
+
+/* Moves the cell to character 'index': its lit columns, then the spacing */
+static void CellStart(RENDER_T *r, uint16 index)
+{
+    uint16 code = TextChar(r, index);
+    uint8 extent, width;
+    
+    r->cell = index;
+    r->cellColumn = 0;
+    r->cellSprite = SpriteColumns(code, &width);
+    if (r->cellSprite != NULL)
+    {
+        r->cellFirst = 0;
+        r->cellWidth = width;
+        r->cellAdvance = (r->spacing == RENDER_FIXED) ? ((width + 7) & ~7) : (width + r->spacing);
+    }
+    else if (r->spacing == RENDER_FIXED)
+    {
+        r->cellFirst = 0;
+        r->cellWidth = 8;
+        r->cellAdvance = 8;
+    }
+    else
+    {
+        extent = GlyphExtent(code);
+        r->cellFirst = FONT_EXTENT_FIRST(extent);
+        r->cellWidth = FONT_EXTENT_WIDTH(extent);
+        r->cellAdvance = r->cellWidth + r->spacing;
+    }
+}
+
+/* Moves the cell on by 'columns', into the characters that follow */
+static void CellSkip(RENDER_T *r, uint16 columns)
+{
+    while (columns >= (uint16)(r->cellAdvance - r->cellColumn))
+    {
+        columns -= r->cellAdvance - r->cellColumn;
+        CellStart(r, r->cell + 1);
+    }
+    r->cellColumn += columns;
+}
+
+static uint8 Glyph(RENDER_T *r, uint8 attr)
+{
+    uint8 bits = 0;
+    
+    if (r->cellColumn < r->cellWidth)
+    {
+        /* A sprite is read straight from flash */
+        bits = (r->cellSprite != NULL) ? r->cellSprite[r->cellColumn] :
+            GlyphColumns(TextChar(r, r->cell))[r->cellFirst + r->cellColumn];
+    }
+    return (attr & RENDER_ATTR_INVERSE) ? (uint8)~bits : bits;
+}
+
+/* Columns the characters [start, start + length) scroll through */
+static uint16 RunColumns(RENDER_T *r, uint16 start, uint16 length)
+{
+    uint16 columns = 0;
+    uint16 i;
+    
+    for (i = start; i < (start + length); i++)
+    {
+        CellStart(r, i);
+        columns += r->cellAdvance;
+        if (TextShown(r))
+        {
+            break;
+        }
+    }
+    return columns;
+}
+
+/* The same drawn still, without the spacing after the last character */
+static uint16 RunWidth(RENDER_T *r, uint16 start, uint16 length)
+{
+    uint16 columns = RunColumns(r, start, length);
+    
+    return (r->spacing == RENDER_FIXED) ? columns : (columns - r->spacing);
+}
+
+/* What the zone should show: the window with blinking columns blanked */
+void RenderShown(const RENDER_T *r, uint8 *shown)
+{
+    uint16 x;
+    
+    for (x = 0; x < r->width; x++)
+    {
+        shown[x] = (r->blinkOff && (r->windowAttr[x] & RENDER_ATTR_BLINK)) ? 0 : r->window[x];
+    }
+}
+
+static void ScrollIn(RENDER_T *r, uint8 column, uint8 attr)
+{
+    memmove(r->window, &r->window[1], r->width - 1);
+    memmove(r->windowAttr, &r->windowAttr[1], r->width - 1);
+    r->window[r->width - 1] = column;
+    r->windowAttr[r->width - 1] = attr;
+    r->changed = TRUE;
+}
+
+/* Draws the characters [start, start + length) still with 'arg'. A variable
+* may not fit, and is then drawn from the left and cut off. */
+static void DrawStatic(RENDER_T *r, uint16 start, uint16 length, uint8 arg)
+{
+    uint16 width = (length != 0) ? RunWidth(r, start, length) : 0;
+    uint16 first = 0;
+    uint16 x;
+    
+    if (((arg & RENDER_ALIGN_MASK) == RENDER_ALIGN_CENTER) && (width < r->width))
+    {
+        first = (r->width - width) / 2;
+    }
+    else if (((arg & RENDER_ALIGN_MASK) == RENDER_ALIGN_RIGHT) && (width < r->width))
+    {
+        first = r->width - width;
+    }
+    
+    memset(r->window, 0, r->width);
+    memset(r->windowAttr, 0, r->width);
+    CellStart(r, start);
+    for (x = first; (x < (first + width)) && (x < r->width); x++)
+    {
+        r->window[x] = Glyph(r, arg);
+        r->windowAttr[x] = arg;
+        CellSkip(r, 1);
+    }
+    r->changed = TRUE;
+}
+
+static uint8 StillRuns(const RENDER_T *r)
+{
+    uint8 runs = 0;
+    uint8 i;
+    
+    for (i = 0; i < r->opCount; i++)
+    {
+        runs += (r->program[i].op == RENDER_OP_STATIC) || (r->program[i].op == RENDER_OP_VAR_STILL);
+    }
+    return runs;
+}
+
+/* TRUE if the one still run of a program that holds is a variable that
+* changed since it was drawn */
+static uint8 StillVarChanged(const RENDER_T *r)
+{
+    uint8 i;
+    
+    for (i = 0; i < r->opCount; i++)
+    {
+        if (r->program[i].op == RENDER_OP_VAR_STILL)
+        {
+            return VarVersion((uint8)r->program[i].start) != r->varVersion;
+        }
+    }
+    return FALSE;
+}
+
+static void NextOp(RENDER_T *r)
+{
+    r->pc++;
+    r->step = 0;
+}
+
+/* Drops the program, giving up its hold on the variables it shows */
+static void ReleaseVars(RENDER_T *r)
+{
+    uint8 i;
+    
+    for (i = 0; i < r->opCount; i++)
+    {
+        if ((r->program[i].op == RENDER_OP_VAR) || (r->program[i].op == RENDER_OP_VAR_STILL))
+        {
+            VarRelease((uint8)r->program[i].start);
+        }
+    }
+    r->opCount = 0;
+}
+
+/*******************************************************************************
+* Function Name: RenderStart
+********************************************************************************
+*
+* Summary:
+*  Compiles the markup of a text into the zone's program and starts running it
+*  from the beginning. This is the only place the text is parsed; the columns
+*  already in the zone stay and are scrolled out by the new text. If the
+*  program does not fit in RENDER_MAX_OPS the text is shown as typed. 'first'
+*  and 'width' must be set before the first call.
+*
+*******************************************************************************/
+void RenderStart(RENDER_T *r, const TEXT_DESC_T *text)
+{
+    uint8 i;
+    
+    ReleaseVars(r);
+    r->source = text;
+    r->charsRead = 0;
+    r->charNext = 0;
+    r->inVar = FALSE;
+    if (text->source == TEXT_SOURCE_PACKED)
+    {
+        LzStart(&packedState, (const uint8 *)text->text);
+        r->packedIndex = 0;
+    }
+    if ((text->source == TEXT_SOURCE_PACKED) || !Compile(r, text))
+    {
+        ReleaseVars(r);
+        r->plain = TRUE;
+        if (text->length != 0)
+        {
+            Emit(r, RENDER_OP_TEXT, 0, 0,
+                (text->source == TEXT_SOURCE_PACKED) ? text->length : Utf8Count(text->text, text->length));
+        }
+        Emit(r, RENDER_OP_END, 0, 0, 0);
+    }
+    
+    r->columns = 0;
+    if (r->plain && (r->program[0].op == RENDER_OP_TEXT))
+    {
+        r->columns = RunColumns(r, 0, r->program[0].length);
+    }
+    r->still = TRUE;
+    for (i = 0; i < r->opCount; i++)
+    {
+        if ((r->program[i].op == RENDER_OP_TEXT) || (r->program[i].op == RENDER_OP_VAR))
+        {
+            r->still = FALSE;
+        }
+    }
+    r->divider = r->baseDivider;
+    r->pc = 0;
+    r->step = 0;
+    r->blinkOff = FALSE;
+    r->blinkTicks = DisplayStepRate(r->divider) / 2;
+    
+    /* Start from what is on the panel, whichever mode drew it */
+    FramebufferRead(r->first, r->window, r->width);
+    memset(r->windowAttr, 0, r->width);
+    r->changed = FALSE;
+}
+
+/*******************************************************************************
+* Function Name: RenderTick
+********************************************************************************
+*
+* Summary:
+*  Called by the zone compositor once per step of the zone. Runs the program
+*  until an op has produced this step's output. The worst case is bounded: at
+*  most RENDER_MAX_OPS speed or zero pauses back to back, then either one
+*  scrolled column, which costs one glyph lookup and, at the start of a
+*  character, one decode and extent lookup, with up to four LzNext calls for
+*  packed text, or a
+*  still run or blink change, which redraws the zone's columns. A pause sets
+*  nothing in 'changed', so a still zone is not composited again. At the end
+*  a program that scrolls clears the zone by scrolling it empty; one that only
+*  has still runs starts over at once, or holds if it has just one.
+*
+*******************************************************************************/
+void RenderTick(RENDER_T *r)
+{
+    const RENDER_OP_T *op;
+    uint8 ops;
+    
+    if (r->blinkTicks == 0)
+    {
+        r->blinkOff = !r->blinkOff;
+        r->blinkTicks = DisplayStepRate(r->divider) / 2;
+        r->changed = TRUE;
+    }
+    else
+    {
+        r->blinkTicks--;
+    }
+    
+    for (ops = 0; ops < RENDER_MAX_OPS; ops++)
+    {
+        op = &r->program[r->pc];
+        switch (op->op)
+        {
+            case RENDER_OP_TEXT:
+            case RENDER_OP_VAR:
+                if (r->step == 0)
+                {
+                    if (op->op == RENDER_OP_TEXT)
+                    {
+                        CellStart(r, op->start);
+                    }
+                    else if (VarFetch(r, (uint8)op->start) != 0)
+                    {
+                        CellStart(r, 0);
+                    }
+                    else
+                    {
+                        /* Nothing to scroll in */
+                        r->inVar = FALSE;
+                        NextOp(r);
+                        break;
+                    }
+                }
+                ScrollIn(r, Glyph(r, op->arg), op->arg);
+                r->step++;
+                if (++r->cellColumn >= r->cellAdvance)
+                {
+                    if (TextShown(r) || ((op->op == RENDER_OP_TEXT) && ((r->cell + 1) >= (op->start + op->length))))
+                    {
+                        r->inVar = FALSE;
+                        NextOp(r);
+                        return;
+                    }
+                    CellStart(r, r->cell + 1);
+                }
+                return;
+                
+            case RENDER_OP_STATIC:
+                DrawStatic(r, op->start, op->length, op->arg);
+                NextOp(r);
+                return;
+                
+            case RENDER_OP_VAR_STILL:
+                DrawStatic(r, 0, VarFetch(r, (uint8)op->start), op->arg);
+                r->inVar = FALSE;
+                NextOp(r);
+                return;
+                
+            case RENDER_OP_PAUSE:
+                if (r->step == 0)
+                {
+                    r->hold = ((uint32)op->arg * DisplayStepRate(r->divider)) / 10;
+                }
+                if (r->step < r->hold)
+                {
+                    r->step++;
+                    return;
+                }
+                NextOp(r);
+                break;
+                
+            case RENDER_OP_SPEED:
+                r->divider = 255 - (op->arg % 201);
+                NextOp(r);
+                break;
+                
+            default:
+                if (r->still)
+                {
+                    /* Nothing scrolls: still runs follow each other without
+                    * blank columns, and a single one stays put as a label */
+                    if (StillRuns(r) > 1)
+                    {
+                        r->divider = r->baseDivider;
+                        r->pc = 0;
+                        r->step = 0;
+                    }
+                    else if (StillVarChanged(r))
+                    {
+                        /* Run the program again to draw the new value */
+                        r->pc = 0;
+                        r->step = 0;
+                        break;
+                    }
+                    return;
+                }
+                ScrollIn(r, 0, 0);
+                if (++r->step >= r->width)
+                {
+                    r->divider = r->baseDivider;
+                    r->pc = 0;
+                    r->step = 0;
+                }
+                return;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: RenderSplice
+********************************************************************************
+*
+* Summary:
+*  Called after the text was edited in place: the edit ended at byte 'end'
+*  of the old text and changed its length by 'delta' bytes. 'text' may be a
+*  copy of the text being shown that now replaces it. Plain
+*  text keeps scrolling: an edit behind the visible window moves the scroll by
+*  the change in its columns so the same characters stay in the zone, one
+*  ahead of it needs nothing, and the visible columns are redrawn from the new
+*  text. Text with markup is recompiled and starts over.
+*
+*******************************************************************************/
+void RenderSplice(RENDER_T *r, const TEXT_DESC_T *text, uint16 end, int16 delta)
+{
+    int16 first = (int16)r->step - r->width;
+    uint8 wasScrolling = r->plain && (r->pc == 0) && (r->program[0].op == RENDER_OP_TEXT);
+    uint16 oldStep = r->step;
+    uint16 oldColumns = r->columns;
+    int16 shift;
+    uint16 x;
+    
+    RenderStart(r, text);
+    if (!wasScrolling || !r->plain || (r->program[0].op != RENDER_OP_TEXT))
+    {
+        return;
+    }
+    
+    /* The scroll counts columns. The text after the edit is unchanged and
+    * takes as many columns as before, so the edit ended 'shift' columns
+    * further into the new text than into the old one. */
+    shift = (int16)r->columns - (int16)oldColumns;
+    end = RunColumns(r, 0, Utf8Count(text->text, end + delta));
+    if ((first >= 0) && (((int16)end - shift) <= first))
+    {
+        oldStep += shift;
+        first += shift;
+    }
+    if (oldStep >= r->columns)
+    {
+        /* The scroll was past the new end of the text */
+        return;
+    }
+    r->step = oldStep;
+    
+    CellStart(r, 0);
+    if (first > 0)
+    {
+        CellSkip(r, first);
+    }
+    for (x = 0; x < r->width; x++)
+    {
+        r->window[x] = 0;
+        if (((int16)x + first) >= 0)
+        {
+            r->window[x] = Glyph(r, 0);
+            CellSkip(r, 1);
+        }
+        r->windowAttr[x] = 0;
+    }
+    r->changed = TRUE;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,142 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _RENDER_H_
+#define _RENDER_H_
+
+#include <main.h>
+#include <TextSource.h>
+#include <Framebuffer.h>
+#include <Lz.h>
+#include <Var.h>
+
+/*******************************************************************************
+* Render Defines
+*******************************************************************************/
+/* Message markup, compiled once by RenderStart:
+*   <pN>          hold the panel for N tenths of a second
+*   <sN>          scroll what follows at speed N, same range as SPEED Control
+*   <b> </b>      blink on / off
+*   <i> </i>      inverse video on / off
+*   <l> <c> <r>   draw the next run of text (up to the next tag) still, left,
+*                 centre or right aligned, if it fits in the zone
+*   <<            a literal '<'
+*   {name}        the value of a variable (Var.h), read when the scroll
+*                 reaches it; after <l> <c> or <r> it is drawn still, and
+*                 drawn again when it changes
+*   {{            a literal '{'
+* Anything else is shown as typed. Packed text is never parsed. Text is UTF-8
+* (Glyph.h): ops and the executor count characters, not bytes.
+*
+* Text is proportional: each character takes only its lit columns
+* (GlyphExtent) and is followed by 'spacing' blank ones, so the executor walks
+* the text a character at a time rather than in cells of 8 columns.
+* RENDER_FIXED gives every character its full 8 columns, as before. A sprite
+* (Sprite.h) is a character as wide as the sprite, with no columns trimmed;
+* in cells of 8 it takes as many cells as it needs. */
+#define RENDER_MAX_OPS      16      // a message that needs more is shown as typed
+#define RENDER_SPACING      1       // default blank columns after each character
+#define RENDER_SPACING_MAX  7
+#define RENDER_FIXED        0xFF    // spacing for cells of 8 columns
+
+#define RENDER_OP_TEXT      0       // scroll in the text one column per tick, arg = attributes
+#define RENDER_OP_STATIC    1       // draw the text on the panel at once, arg = attributes | alignment
+#define RENDER_OP_PAUSE     2       // hold the zone for arg tenths of a second
+#define RENDER_OP_SPEED     3       // change the scroll speed to arg
+#define RENDER_OP_END       4       // scroll the zone empty, then start over; see RenderTick
+#define RENDER_OP_VAR       5       // scroll in the value of variable 'start', arg = attributes
+#define RENDER_OP_VAR_STILL 6       // draw it on the panel at once, arg = attributes | alignment
+
+#define RENDER_ATTR_BLINK   0x01
+#define RENDER_ATTR_INVERSE 0x02
+#define RENDER_ALIGN_LEFT   0x00
+#define RENDER_ALIGN_CENTER 0x10
+#define RENDER_ALIGN_RIGHT  0x20
+#define RENDER_ALIGN_MASK   0x30
+
+typedef struct
+{
+    uint8 op;
+    uint8 arg;
+    uint16 start;           // first character in the source text
+    uint16 length;          // characters, for TEXT and STATIC; bytes for packed text
+} RENDER_OP_T;
+
+/* One renderer per zone. It only updates its own window; the zone compositor
+* copies the window into the framebuffer when 'changed' is set. */
+typedef struct
+{
+    RENDER_OP_T program[RENDER_MAX_OPS];
+    uint8 opCount;
+    const TEXT_DESC_T *source;
+    uint8 plain;                    // TRUE if the source had no markup
+    uint8 still;                    // TRUE if nothing in the program scrolls
+    
+    uint16 first;                   // zone columns in the panel
+    uint16 width;
+    uint8 baseDivider;              // Timer_CLK divider for the zone's speed
+    uint8 divider;                  // the same, changed by <sN> until the program restarts
+    uint8 spacing;                  // blank columns after each character, or RENDER_FIXED
+    
+    /* Executor state: the op being run and how far into it */
+    uint8 pc;
+    uint16 step;
+    uint16 hold;
+    uint16 columns;                 // columns a plain program's text scrolls through
+    
+    /* The character a TEXT op is in and the column of it */
+    uint16 cell;
+    uint8 cellColumn;
+    uint8 cellFirst;                // its first lit column in the glyph
+    uint8 cellWidth;                // lit columns shown
+    uint8 cellAdvance;              // the same plus the spacing after it
+    const volatile uint8 *cellSprite;   // its columns in flash if it is a sprite, else NULL
+    
+    /* What the zone shows before blinking is applied */
+    uint8 window[FB_COLUMNS];
+    uint8 windowAttr[FB_COLUMNS];
+    uint8 blinkOff;
+    uint16 blinkTicks;
+    uint8 changed;
+    
+    /* The character last decoded, so the columns of one character and runs
+    * of them cost one decode each */
+    uint16 charsRead;               // characters decoded from the start of the text
+    uint16 charNext;                // byte offset of the next one
+    uint16 charCode;
+    
+    /* Packed text is unpacked one byte at a time as the scroll reaches it.
+    * Only zone 0 shows packed text, so the decoder and its window are kept
+    * once, in Render.c, rather than in every zone. */
+    uint16 packedIndex;
+    char packedChar;
+    
+    /* A variable's value is copied when the executor reaches it and decoded
+    * from the copy, leaving the place in the text as it was */
+    uint8 inVar;                    // TRUE while characters come from the copy
+    uint8 varVersion;               // of the value copied
+    uint8 varLength;
+    uint8 varRead;
+    uint8 varNext;
+    uint16 varCode;
+    char varText[VAR_VALUE_SIZE];
+} RENDER_T;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void RenderStart(RENDER_T *r, const TEXT_DESC_T *text);
+void RenderTick(RENDER_T *r);
+void RenderSplice(RENDER_T *r, const TEXT_DESC_T *text, uint16 end, int16 delta);
+void RenderShown(const RENDER_T *r, uint8 *shown);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Scale.h>
+
+/* Each bit of a nibble doubled, and tripled: bit i becomes bits 2i and
+* 2i + 1, or 3i to 3i + 2 */
+static const uint8 spread2[16] =
+{
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF,
+};
+
+static const uint16 spread3[16] =
+{
+    0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF,
+    0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF,
+};
+
+uint8 ScaleValid(uint8 size)
+{
+    return (size == SCALE_1X) || (size == SCALE_2X) || (size == SCALE_3X) || (size == SCALE_TALL);
+}
+
+/* A column of 8 pixels stretched to 'height' x 8, bit 0 still the top pixel:
+* two table lookups rather than a loop over the pixels */
+uint32 ScaleColumn(uint8 bits, uint8 height)
+{
+    if (height == 2)
+    {
+        return spread2[bits & 0x0F] | ((uint32)spread2[bits >> 4] << 8);
+    }
+    if (height == 3)
+    {
+        return spread3[bits & 0x0F] | ((uint32)spread3[bits >> 4] << 12);
+    }
+    return bits;
+}
+
+/*******************************************************************************
+* Function Name: ScaleColumns
+********************************************************************************
+*
+* Summary:
+*  Draws the columns a zone rendered at the normal size into 'scene' at
+*  'size'. The scene is SCALE_HEIGHT rows of 'stride' columns, the top module
+*  row first, laid out the way the framebuffer's column space follows rows of
+*  modules. Each rendered column is stretched once and stored into its
+*  SCALE_WIDTH x SCALE_HEIGHT bytes, so a panel column costs a couple of
+*  stores whatever the size. 'shown' must cover 'stride' / SCALE_WIDTH
+*  columns, rounded up.
+*
+*******************************************************************************/
+void ScaleColumns(const uint8 *shown, uint8 size, uint8 *scene, uint16 stride)
+{
+    uint8 width = SCALE_WIDTH(size);
+    uint8 height = SCALE_HEIGHT(size);
+    uint32 tall;
+    uint16 x = 0;
+    uint8 *out;
+    uint8 i, row;
+    
+    while (x < stride)
+    {
+        tall = ScaleColumn(*shown++, height);
+        for (i = 0; (i < width) && (x < stride); i++, x++)
+        {
+            out = &scene[x];
+            for (row = 0; row < height; row++)
+            {
+                *out = (uint8)(tall >> (8 * row));
+                out += stride;
+            }
+        }
+    }
+}
+
+/* [] END OF FILE */
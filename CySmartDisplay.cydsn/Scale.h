@@ -0,0 +1,41 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _SCALE_H_
+#define _SCALE_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Scale Defines
+*******************************************************************************/
+/* Text size of a zone, (height << 4) | width in multiples of the 8 pixel font.
+* A zone renders its text at the normal size and each column is spread over
+* 'width' panel columns of 'height' module rows as it is composited, so a
+* scroll step moves the text 'width' pixels. Taller sizes need a zone that
+* starts a module row and covers 'height' of them; a zone that does not is
+* drawn at SCALE_1X. */
+#define SCALE_1X            0x11
+#define SCALE_2X            0x22
+#define SCALE_3X            0x33
+#define SCALE_TALL          0x21    // double height, normal width
+#define SCALE_WIDTH(s)      ((s) & 0x0F)
+#define SCALE_HEIGHT(s)     ((s) >> 4)
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint8 ScaleValid(uint8 size);
+uint32 ScaleColumn(uint8 bits, uint8 height);
+void ScaleColumns(const uint8 *shown, uint8 size, uint8 *scene, uint16 stride);
+
+#endif
+/* [] END OF FILE */
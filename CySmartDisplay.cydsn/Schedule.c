@@ -0,0 +1,279 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Schedule.h>
+#include <Clock.h>
+#include <Command.h>
+#include <Crc.h>
+
+/* Each slot is the write as it came, padded to whole rows of flash */
+static volatile const uint8 FLASH_ALIGN FLASH_SECTION scheduleStore[SCHEDULE_COUNT][SCHEDULE_SLOT_SIZE] = {{0}};
+
+/* Slots that hold a window whose checksum matched, a bit each */
+static uint8 scheduleValid;
+
+static uint8 scheduleActive = SCHEDULE_NONE;
+static uint8 scheduleOff = FALSE;
+static uint8 scheduleChanged = TRUE;    // evaluate at the next pass, whatever the time
+static uint32 scheduleLast;             // time of the last evaluation
+static uint32 scheduleNext;             // time of the next window edge
+
+#define START(w)    ((w)[2] | ((uint16)(w)[3] << 8))
+#define END(w)      ((w)[4] | ((uint16)(w)[5] << 8))
+
+/* The checksum of a write, or of a slot: the first 8 bytes, then the batch */
+uint16 ScheduleChecksum(const volatile uint8 *window)
+{
+    return Crc16(Crc16(CRC16_INIT, window, 8), &window[SCHEDULE_HEADER], window[7]);
+}
+
+static uint8 SlotValid(const volatile uint8 *slot, uint8 id)
+{
+    return (slot[0] == id) && (slot[1] != 0) && (START(slot) < SCHEDULE_MINUTES) &&
+        (END(slot) < SCHEDULE_MINUTES) && (slot[7] <= (SCHEDULE_SIZE - SCHEDULE_HEADER)) &&
+        (ScheduleChecksum(slot) == (slot[8] | ((uint16)slot[9] << 8)));
+}
+
+/* Finds the windows left in flash from before the reset */
+void ScheduleInit(void)
+{
+    uint8 i;
+    
+    scheduleValid = 0;
+    for (i = 0; i < SCHEDULE_COUNT; i++)
+    {
+        if (SlotValid(scheduleStore[i], i))
+        {
+            scheduleValid |= 1u << i;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: ScheduleWrite
+********************************************************************************
+*
+* Summary:
+*  Checks a write to SCHEDULE Control and stores the window in its slot.
+*  Called from the main loop, where the rows are written. The batch is checked
+*  as a COMMAND write would be, so a window never applies a bad one. The table
+*  is evaluated again at the next pass.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if the window was stored, otherwise the error to send.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T ScheduleWrite(const uint8 *data, uint16 length)
+{
+    CYBLE_GATT_ERR_CODE_T gattErr;
+    uint8 row[FLASH_ROW_SIZE];
+    uint8 id, n;
+    uint16 copy;
+    
+    if ((length < SCHEDULE_HEADER) || (length != (SCHEDULE_HEADER + data[7])))
+    {
+        return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+    }
+    id = data[0];
+    if ((id >= SCHEDULE_COUNT) || (START(data) >= SCHEDULE_MINUTES) || (END(data) >= SCHEDULE_MINUTES) ||
+        (data[6] > SCHEDULE_OFF) || (ScheduleChecksum(data) != (data[8] | ((uint16)data[9] << 8))))
+    {
+        return CYBLE_GATT_ERR_OUT_OF_RANGE;
+    }
+    /* A queued scheduled batch may still be read from the slot */
+    if (commandPending)
+    {
+        return GATT_ERR_BUSY;
+    }
+    if ((data[1] != 0) && (data[7] != 0))
+    {
+        gattErr = CommandValid(&data[SCHEDULE_HEADER], data[7]);
+        if (gattErr != CYBLE_GATT_ERR_NONE)
+        {
+            return gattErr;
+        }
+    }
+    
+    scheduleValid &= ~(1u << id);
+    scheduleChanged = TRUE;
+    if (scheduleActive == id)
+    {
+        /* Applied again if it is still active */
+        scheduleActive = SCHEDULE_NONE;
+    }
+    for (n = 0; n < (SCHEDULE_SLOT_SIZE / FLASH_ROW_SIZE); n++)
+    {
+        memset(row, 0, FLASH_ROW_SIZE);
+        if (length > (n * FLASH_ROW_SIZE))
+        {
+            copy = length - (n * FLASH_ROW_SIZE);
+            memcpy(row, &data[n * FLASH_ROW_SIZE], (copy < FLASH_ROW_SIZE) ? copy : FLASH_ROW_SIZE);
+        }
+        gattErr = FlashWriteRow(&scheduleStore[id][n * FLASH_ROW_SIZE], row);
+        if (gattErr != CYBLE_GATT_ERR_NONE)
+        {
+            return gattErr;
+        }
+    }
+    if (data[1] != 0)
+    {
+        scheduleValid |= 1u << id;
+    }
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/* Whether window 'slot' covers time 'now'. One that runs past midnight
+* belongs to the day it started. */
+static uint8 Covers(const volatile uint8 *slot, uint32 now)
+{
+    uint16 minute = (now / 60u) % SCHEDULE_MINUTES;
+    uint8 today = (uint8)(((now / 86400u) + 4u) % 7u);     // 1970-01-01 was a Thursday
+    uint8 yesterday = (today + 6u) % 7u;
+    uint16 start = START(slot);
+    uint16 end = END(slot);
+    
+    if (start < end)
+    {
+        return (slot[1] & SCHEDULE_DAY(today)) && (minute >= start) && (minute < end);
+    }
+    return ((slot[1] & SCHEDULE_DAY(today)) && (minute >= start)) ||
+        ((slot[1] & SCHEDULE_DAY(yesterday)) && (minute < end));
+}
+
+/* The window that covers 'now', or SCHEDULE_NONE */
+uint8 ScheduleActive(uint32 now)
+{
+    uint8 i;
+    
+    for (i = 0; i < SCHEDULE_COUNT; i++)
+    {
+        if ((scheduleValid & (1u << i)) && Covers(scheduleStore[i], now))
+        {
+            return i;
+        }
+    }
+    return SCHEDULE_NONE;
+}
+
+/* The first minute after 'now' that some window starts or ends at, or never
+* if there are none. The days are left out: an edge on a day the window
+* does not cover only evaluates the table for nothing. */
+uint32 ScheduleNextEdge(uint32 now)
+{
+    uint16 minute = (now / 60u) % SCHEDULE_MINUTES;
+    uint16 next = 2 * SCHEDULE_MINUTES;
+    uint16 edge;
+    const volatile uint8 *slot;
+    uint8 i, n;
+    
+    for (i = 0; i < SCHEDULE_COUNT; i++)
+    {
+        if (!(scheduleValid & (1u << i)))
+        {
+            continue;
+        }
+        slot = scheduleStore[i];
+        for (n = 0; n < 2; n++)
+        {
+            edge = n ? END(slot) : START(slot);
+            if (edge <= minute)
+            {
+                edge += SCHEDULE_MINUTES;   // tomorrow
+            }
+            if (edge < next)
+            {
+                next = edge;
+            }
+        }
+    }
+    if (next == (2 * SCHEDULE_MINUTES))
+    {
+        return ~(uint32)0;
+    }
+    return (now - (now % 86400u)) + (next * 60u);
+}
+
+/*******************************************************************************
+* Function Name: ScheduleService
+********************************************************************************
+*
+* Summary:
+*  Called from the main loop. At a window edge, or after the time or the
+*  table changed, finds the window that covers the time and applies it if it
+*  is not the one already applied. Between edges it costs a compare.
+*
+*  While the panel is shut down the display timer is stopped, so there is no
+*  frame boundary for a COMMAND batch to wait for; it is applied here.
+*
+*******************************************************************************/
+void ScheduleService(void)
+{
+    const volatile uint8 *slot;
+    uint32 now;
+    uint8 active;
+    
+    if (scheduleOff && commandPending)
+    {
+        CommandApply();
+    }
+    if (!ClockSynced())
+    {
+        return;
+    }
+    
+    now = ClockNow();
+    if (!scheduleChanged && (now >= scheduleLast) && (now < scheduleNext))
+    {
+        return;
+    }
+    scheduleChanged = FALSE;
+    scheduleLast = now;
+    scheduleNext = ScheduleNextEdge(now);
+    
+    active = ScheduleActive(now);
+    slot = (active != SCHEDULE_NONE) ? scheduleStore[active] : NULL;
+    if ((active == scheduleActive) &&
+        (!scheduleOff || ((slot != NULL) && (slot[6] & SCHEDULE_OFF))))
+    {
+        /* Unless the window that kept the panel off was deleted or moved */
+        return;
+    }
+    
+    if ((slot != NULL) && (slot[6] & SCHEDULE_OFF))
+    {
+        if (!scheduleOff)
+        {
+            scheduleOff = TRUE;
+            DisplayPower(FALSE);
+        }
+    }
+    else
+    {
+        if (scheduleOff)
+        {
+            scheduleOff = FALSE;
+            DisplayPower(TRUE);
+        }
+        /* A batch a client queued goes first; this one is tried again at the
+        * next pass. One that no longer checks out, say for an animation
+        * since deleted, is left out. The batch is parsed in place, as a plain
+        * buffer: the slot is not rewritten until it has been applied. */
+        if ((slot != NULL) && (slot[7] != 0) &&
+            (CommandSchedule((const uint8 *)&slot[SCHEDULE_HEADER], slot[7]) == GATT_ERR_BUSY))
+        {
+            scheduleChanged = TRUE;
+            return;
+        }
+    }
+    scheduleActive = active;
+}
+
+/* [] END OF FILE */
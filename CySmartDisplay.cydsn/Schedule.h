@@ -0,0 +1,57 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _SCHEDULE_H_
+#define _SCHEDULE_H_
+
+#include <main.h>
+#include <Flash.h>
+
+/*******************************************************************************
+* Schedule Defines
+*******************************************************************************/
+/* Time windows uploaded over SCHEDULE Control and kept in flash, one slot
+* each. A window covers minutes 'start' to 'end' of the local day (Clock.h)
+* on the days in its mask, and runs past midnight when 'end' is not after
+* 'start'. When a window starts, its COMMAND batch (Command.h) is applied:
+* text, brightness, speed, an animation and so on. A window with
+* SCHEDULE_OFF puts the panel in shutdown instead and stops the display
+* timer until it ends. Where windows overlap the lowest id wins. Outside
+* every window the panel shows what it was last sent.
+*
+* A write is [id] [days] [start, LE] [end, LE] [flags] [batch length]
+* [CRC-16 of the rest, LE] [batch...]. The CRC is CRC-16/CCITT-FALSE over the
+* first 8 bytes and the batch. Days 0 deletes the window.
+*
+* The table is evaluated at window edges only: the next start or end is
+* worked out after each change, and the main loop compares the time with it. */
+#define SCHEDULE_COUNT      8
+#define SCHEDULE_HEADER     10
+#define SCHEDULE_SIZE       180     // SCHEDULE Control, header and batch
+#define SCHEDULE_SLOT_SIZE  (2 * FLASH_ROW_SIZE)    // whole rows, at least SCHEDULE_SIZE
+#define SCHEDULE_MINUTES    1440    // in a day
+#define SCHEDULE_NONE       0xFF    // no window is active
+
+#define SCHEDULE_DAY(d)     (1u << (d))     // 0 Sunday to 6 Saturday
+#define SCHEDULE_OFF        0x01    // shut the panel down for the window
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void ScheduleInit(void);
+uint16 ScheduleChecksum(const volatile uint8 *window);
+CYBLE_GATT_ERR_CODE_T ScheduleWrite(const uint8 *data, uint16 length);
+uint8 ScheduleActive(uint32 now);
+uint32 ScheduleNextEdge(uint32 now);
+void ScheduleService(void);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,123 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Sprite.h>
+#include <Crc.h>
+
+/* Each slot is the write as it came, padded to whole rows of flash */
+static volatile const uint8 FLASH_ALIGN FLASH_SECTION spriteStore[SPRITE_COUNT][SPRITE_SLOT_SIZE] = {{0}};
+
+/* Slots that hold a sprite whose checksum matched, a bit each */
+static volatile uint16 spriteValid;
+
+volatile uint8 spritesChanged;
+
+/* The checksum of a write, or of a slot: the id and width, then the columns,
+* skipping the checksum itself */
+uint16 SpriteChecksum(const volatile uint8 *sprite)
+{
+    return Crc16(Crc16(CRC16_INIT, sprite, 2), &sprite[SPRITE_HEADER], sprite[1]);
+}
+
+static uint8 SlotValid(const volatile uint8 *slot, uint8 id)
+{
+    return (slot[0] == id) && (slot[1] != 0) && (slot[1] <= SPRITE_MAX_WIDTH) &&
+        (SpriteChecksum(slot) == (slot[2] | ((uint16)slot[3] << 8)));
+}
+
+/* Finds the sprites left in flash from before the reset */
+void SpriteInit(void)
+{
+    uint8 i;
+    
+    spriteValid = 0;
+    for (i = 0; i < SPRITE_COUNT; i++)
+    {
+        if (SlotValid(spriteStore[i], i))
+        {
+            spriteValid |= 1u << i;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: SpriteWrite
+********************************************************************************
+*
+* Summary:
+*  Checks a write to SPRITE Control and stores the sprite in its slot. Called
+*  from the main loop: the rows are written there, and the slot is left out
+*  while they are, so the renderer shows the missing glyph rather than half
+*  a sprite. Display_ISR starts the zones over once it is done, as their
+*  text may now be wider or narrower.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE if the sprite was stored, otherwise the error to send.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T SpriteWrite(const uint8 *data, uint16 length)
+{
+    CYBLE_GATT_ERR_CODE_T gattErr;
+    uint8 row[FLASH_ROW_SIZE];
+    uint8 id, n;
+    uint16 copy;
+    
+    if ((length < SPRITE_HEADER) || (length != (SPRITE_HEADER + data[1])))
+    {
+        return CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN;
+    }
+    id = data[0];
+    if ((id >= SPRITE_COUNT) || (SpriteChecksum(data) != (data[2] | ((uint16)data[3] << 8))))
+    {
+        return CYBLE_GATT_ERR_OUT_OF_RANGE;
+    }
+    
+    spriteValid &= ~(1u << id);
+    for (n = 0; n < (SPRITE_SLOT_SIZE / FLASH_ROW_SIZE); n++)
+    {
+        memset(row, 0, FLASH_ROW_SIZE);
+        if (length > (n * FLASH_ROW_SIZE))
+        {
+            copy = length - (n * FLASH_ROW_SIZE);
+            memcpy(row, &data[n * FLASH_ROW_SIZE], (copy < FLASH_ROW_SIZE) ? copy : FLASH_ROW_SIZE);
+        }
+        gattErr = FlashWriteRow(&spriteStore[id][n * FLASH_ROW_SIZE], row);
+        if (gattErr != CYBLE_GATT_ERR_NONE)
+        {
+            spritesChanged = TRUE;
+            return gattErr;
+        }
+    }
+    if (data[1] != 0)
+    {
+        spriteValid |= 1u << id;
+    }
+    spritesChanged = TRUE;
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/* The columns of the sprite code point 'code' stands for and its width, or
+* NULL if it is not a sprite or none was uploaded */
+const volatile uint8 *SpriteColumns(uint16 code, uint8 *width)
+{
+    uint16 id = code - SPRITE_CODE_FIRST;
+    const volatile uint8 *slot;
+    
+    if ((id >= SPRITE_COUNT) || !(spriteValid & (1u << id)))
+    {
+        return NULL;
+    }
+    slot = spriteStore[id];
+    *width = slot[1];
+    return &slot[SPRITE_HEADER];
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,49 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _SPRITE_H_
+#define _SPRITE_H_
+
+#include <main.h>
+#include <Flash.h>
+
+/*******************************************************************************
+* Sprite Defines
+*******************************************************************************/
+/* Monochrome bitmaps uploaded over SPRITE Control and kept in flash, one slot
+* each. A sprite is 8 pixels tall and up to SPRITE_MAX_WIDTH columns wide,
+* a byte per column, bit 0 at the top, like a glyph. Text shows sprite n
+* where it has the private use code point SPRITE_CODE(n), UTF-8 EE 80 80+n,
+* and scrolls it like a character as wide as the sprite.
+*
+* A write is [id] [width] [CRC-16 of the rest, LE] [width columns]. The CRC is
+* CRC-16/CCITT-FALSE over the id, the width and the columns. Width 0 with no
+* columns deletes the sprite. */
+#define SPRITE_COUNT        16
+#define SPRITE_HEADER       4
+#define SPRITE_SIZE         180     // SPRITE Control, header and columns
+#define SPRITE_MAX_WIDTH    (SPRITE_SIZE - SPRITE_HEADER)
+#define SPRITE_SLOT_SIZE    (2 * FLASH_ROW_SIZE)    // whole rows, at least SPRITE_SIZE
+#define SPRITE_CODE_FIRST   0xE000u
+#define SPRITE_CODE(n)      (SPRITE_CODE_FIRST + (n))
+
+extern volatile uint8 spritesChanged;   // set by SpriteWrite, cleared by Display_ISR
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void SpriteInit(void);
+uint16 SpriteChecksum(const volatile uint8 *sprite);
+CYBLE_GATT_ERR_CODE_T SpriteWrite(const uint8 *data, uint16 length);
+const volatile uint8 *SpriteColumns(uint16 code, uint8 *width);
+
+#endif
+/* [] END OF FILE */
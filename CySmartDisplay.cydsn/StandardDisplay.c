@@ -12,6 +12,18 @@
 
 #include <main.h>
 #include <font.h>
+#include <Framebuffer.h>
+#include <LiveStream.h>
+#include <TextSource.h>
+#include <Command.h>
+#include <Ticker.h>
+#include <Lz.h>
+#include <Zone.h>
+#include <Gray.h>
+#include <Glyph.h>
+#include <Sprite.h>
+#include <Anim.h>
+#include <Page.h>
 
 const uint8 MAX7219_REG_NOOP        = 0x0;
 const uint8 MAX7219_REG_DIGIT0      = 0x1;
@@ -28,7 +40,7 @@ const uint8 MAX7219_REG_SCANLIMIT   = 0xB;
 const uint8 MAX7219_REG_SHUTDOWN    = 0xC;
 const uint8 MAX7219_REG_DISPLAYTEST = 0xF;
 
-uint16 pos = 0;
+volatile uint8 displayMode = DISPLAY_MODE_TEXT;
 
 void SendPacketNoCS(const uint8 reg, uint8 data)
 {    
@@ -50,7 +62,7 @@ void showLetterIndex(const uint8 c, uint8 index, uint8 total)
         {
             if (disp == index)
             {
-                SendPacketNoCS (col + 1, cp437_font [c] [col]);
+                SendPacketNoCS (col + 1, GlyphColumns(GLYPH_RAW_BYTE | c) [col]);
             }
             else
             {
@@ -87,7 +99,7 @@ void scrollString (const char * s, const uint32 time)
     {
         for (col = 0; col < 8; col++)
         {
-            SendPacketNoCS (col + 1, cp437_font [(uint8)s[depth/8]] [depth%8]);
+            SendPacketNoCS (col + 1, GlyphColumns(GLYPH_RAW_BYTE | (uint8)s[depth/8]) [depth%8]);
             depth++;
         }
         depth-=7;
@@ -119,74 +131,357 @@ void showColumn(uint8 module, uint8 column, uint8 value)
     CyDelayUs(SPI_DELAY);
 }
 
-char buffer[180] = {0};
-char dispbuffer[MODULE_COUNT * 8] = {0};
+static const TEXT_DESC_T emptyText = { "", 0, TEXT_SOURCE_FLASH };
+static TEXT_DESC_T gattText = { NULL, 0, TEXT_SOURCE_GATT };
+const TEXT_DESC_T * volatile activeText = &emptyText;
+
+/* Packed text is kept as uploaded and unpacked by the renderer */
+static uint8 packedStore[MESSAGE_SIZE];
+static TEXT_DESC_T packedText = { (const char *)packedStore, 0, TEXT_SOURCE_PACKED };
+
 CY_ISR(Display_ISR)
 {
-    uint16 disp;
-    uint8 module, column;
+    /* Batched commands take effect only on a frame boundary */
+    if (commandPending)
+    {
+        CommandApply();
+    }
+    if (spritesChanged)
+    {
+        /* Text that shows a sprite is measured again */
+        spritesChanged = FALSE;
+        ZoneRefresh();
+    }
     
-    for (disp = ((MODULE_COUNT * 8) - 1); disp >= 1; disp--)
+    if (displayMode == DISPLAY_MODE_GRAY)
     {
-        dispbuffer[disp] = dispbuffer[disp-1];
+        GrayTick();
+        DisplayTimer_ClearInterrupt(DisplayTimer_INTR_MASK_TC);
+        return;
     }
-    dispbuffer[0] = (char) cp437_font[(uint8)buffer[pos/8]][pos%8];
+    /* Any other mode runs on the scroll timing */
+    GrayStop();
+    DisplayBaseSpeed();
     
-    for (disp = 0; disp < (MODULE_COUNT * 8); disp++)
+    if (displayMode == DISPLAY_MODE_LIVE)
     {
-        module = ((MODULE_COUNT - (disp/8) - 1));
-        column = (7 - (disp%8));
-        showColumn(module, column, dispbuffer[disp]);
+        /* LiveStreamWrite fills the framebuffer, a frame is latched here */
+        LiveStreamTick();
+        DisplayTimer_ClearInterrupt(DisplayTimer_INTR_MASK_TC);
+        return;
     }
     
-    if (pos < ((strlen(buffer) + MODULE_COUNT) * 8))
+    if (displayMode == DISPLAY_MODE_DRAW)
     {
-        pos++;
+        /* DrawWrite and the clock widgets draw, what they drew is latched here */
+        FramebufferCommit();
+        DisplayTimer_ClearInterrupt(DisplayTimer_INTR_MASK_TC);
+        return;
     }
-    else
+    
+    if (displayMode == DISPLAY_MODE_ANIM)
+    {
+        /* A frame is decoded into the rows it changes, then committed */
+        AnimTick();
+        FramebufferCommit();
+        DisplayTimer_ClearInterrupt(DisplayTimer_INTR_MASK_TC);
+        return;
+    }
+    
+    if (displayMode == DISPLAY_MODE_PAGE)
+    {
+        /* A page coming in moves the framebuffer up a row a tick */
+        PageTick();
+        FramebufferCommit();
+        DisplayTimer_ClearInterrupt(DisplayTimer_INTR_MASK_TC);
+        return;
+    }
+    
+    if (displayMode == DISPLAY_MODE_TICKER)
     {
-        pos = 0;
+        /* The ticker never wraps; an empty ring scrolls in blank columns */
+        FramebufferScroll(TickerNext());
+        FramebufferCommit();
+        DisplayTimer_ClearInterrupt(DisplayTimer_INTR_MASK_TC);
+        return;
     }
     
+    ZoneTick();
+    FramebufferCommit();
+    
     DisplayTimer_ClearInterrupt(DisplayTimer_INTR_MASK_TC);
 }
 
+void DisplayText(const TEXT_DESC_T *desc)
+{
+    uint8 intrStatus = CyEnterCriticalSection();
+    
+    activeText = desc;
+    ZoneStart(0, desc);
+    displayMode = DISPLAY_MODE_TEXT;
+    
+    CyExitCriticalSection(intrStatus);
+}
+
 void DisplayMessage(char *message, uint8 length)
 {
-    uint8 i;
+    const char *end;
+    char *storage = (char *)gattText.text;
+    uint8 intrStatus;
+    
+    if (length > MESSAGE_SIZE)
+    {
+        /* Keep whole UTF-8 characters; the renderer decodes the rest */
+        length = Utf8Trim(message, MESSAGE_SIZE);
+    }
+    
+    /* The text ends at the first NUL, as it did with stpncpy */
+    end = memchr(message, 0, length);
+    if (end != NULL)
+    {
+        length = end - message;
+    }
+    
+    /* The renderer reads the attribute value itself, so this is the only
+    * copy. Display_ISR may be reading the same storage, so the copy is done
+    * with interrupts masked and the scroll restarts from the new text. */
+    intrStatus = CyEnterCriticalSection();
+    
+    memcpy(storage, message, length);
+    CYBLE_GATT_DB_ATTR_SET_ATTR_GEN_LEN(CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_HANDLE, length);
+    gattText.length = length;
+    activeText = &gattText;
+    ZoneStart(0, &gattText);
+    displayMode = DISPLAY_MODE_TEXT;
+    
+    CyExitCriticalSection(intrStatus);
+}
+
+/*******************************************************************************
+* Function Name: DisplayPacked
+********************************************************************************
+*
+* Summary:
+*  Shows an LZ packed message (see Lz.h). Only the packed bytes are stored;
+*  the scroll unpacks each character as it reaches it, so the text may be
+*  longer than MESSAGE_SIZE. The stream must have passed LzValidate.
+*
+* Parameters:
+*  const uint8 *stream: The packed stream.
+*  uint8 size:          Bytes in the stream, at most MESSAGE_SIZE.
+*  uint16 length:       Characters it unpacks to.
+*
+*******************************************************************************/
+void DisplayPacked(const uint8 *stream, uint8 size, uint16 length)
+{
+    uint8 intrStatus = CyEnterCriticalSection();
+    
+    memcpy(packedStore, stream, size);
+    packedText.length = length;
+    activeText = &packedText;
+    ZoneStart(0, &packedText);
+    displayMode = DISPLAY_MODE_TEXT;
+    
+    CyExitCriticalSection(intrStatus);
+}
+
+/*******************************************************************************
+* Function Name: DisplayPaged
+********************************************************************************
+*
+* Summary:
+*  Shows the active message a page at a time (see Page.h), each page held
+*  for 'hold' tenths of a second. Text shown from flash, RAM or a packed
+*  stream is copied to the MESSAGE attribute first, as for a patch, so the
+*  pages are always laid out from plain text.
+*
+*******************************************************************************/
+void DisplayPaged(uint8 hold)
+{
+    uint8 intrStatus = CyEnterCriticalSection();
+    
+    if (activeText != &gattText)
+    {
+        SyncMessageAttribute();
+        gattText.length = TEXT_ATTR_LENGTH(activeText);
+        activeText = &gattText;
+    }
+    PageStart(&gattText, hold);
+    displayMode = DISPLAY_MODE_PAGE;
+    
+    CyExitCriticalSection(intrStatus);
+}
+
+/*******************************************************************************
+* Function Name: MessageSplice
+********************************************************************************
+*
+* Summary:
+*  Edits the active message in place: removes 'remove' characters at 'offset'
+*  and inserts 'length' characters from 'data' there. Used for patch commands,
+*  so callers must have checked that the result fits in MESSAGE_SIZE.
+*
+*  Plain text keeps scrolling through the edit (see RenderSplice) and only the
+*  digits that actually changed are sent to the panel.
+*
+*******************************************************************************/
+void MessageSplice(uint8 offset, uint8 remove, const char *data, uint8 length)
+{
+    char *storage = (char *)gattText.text;
+    int16 delta = (int16)length - remove;
+    uint8 newLength;
+    uint8 intrStatus;
+    
+    intrStatus = CyEnterCriticalSection();
+    
+    if (activeText != &gattText)
+    {
+        /* Patches always edit the MESSAGE attribute */
+        SyncMessageAttribute();
+        gattText.length = TEXT_ATTR_LENGTH(activeText);
+        activeText = &gattText;
+    }
+    
+    newLength = gattText.length + delta;
+    memmove(&storage[offset + length], &storage[offset + remove], gattText.length - offset - remove);
+    memcpy(&storage[offset], data, length);
+    CYBLE_GATT_DB_ATTR_SET_ATTR_GEN_LEN(CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_HANDLE, newLength);
+    gattText.length = newLength;
+    
+    if (displayMode == DISPLAY_MODE_TEXT)
+    {
+        RenderSplice(&zones[0].render, &gattText, offset + remove, delta);
+    }
+    else if (displayMode == DISPLAY_MODE_PAGE)
+    {
+        PageRefresh();
+    }
     
-    Timer_CLK_Stop();
-    pos = 0;
+    CyExitCriticalSection(intrStatus);
+}
+
+/* Called before MESSAGE Control is read. Text shown from flash, RAM or a
+* packed stream is not in the GATT DB, so copy as much as fits there now; the
+* renderer is not reading the attribute storage in that case. Interrupts are
+* masked so Display_ISR cannot apply a batch that changes the text mid-copy. */
+void SyncMessageAttribute(void)
+{
+    const TEXT_DESC_T *text;
+    uint8 intrStatus = CyEnterCriticalSection();
     
-    stpncpy(buffer, message, length);
-    for (i = length; i<180; i++)
+    text = activeText;
+    if (text->source == TEXT_SOURCE_PACKED)
+    {
+        LzExpand(packedStore, (char *)gattText.text, TEXT_ATTR_LENGTH(text));
+    }
+    else if (text->source != TEXT_SOURCE_GATT)
     {
-        buffer[i] = 0;
+        memcpy((char *)gattText.text, text->text, TEXT_ATTR_LENGTH(text));
     }
+    CYBLE_GATT_DB_ATTR_SET_ATTR_GEN_LEN(CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_HANDLE, TEXT_ATTR_LENGTH(text));
     
-    Timer_CLK_Start();
+    CyExitCriticalSection(intrStatus);
 }
 
+/* Goes out with the next frame's commit, so it never splits a latch sent by
+* Display_ISR. In live mode that is the next streamed frame. */
 void DisplayBrightness(uint8 level)
 {
-    uint8 i = 0;
+    fbBrightness = level % 16;  // character intensity: range: 0 to 15
+    FramebufferIntensity(fbBrightness);
+}
+
+/*******************************************************************************
+* Function Name: DisplayPower
+********************************************************************************
+*
+* Summary:
+*  Puts every module in shutdown and stops the display timer, or wakes them
+*  and starts it again. In shutdown a MAX7219 blanks the LEDs and draws a few
+*  hundred µA but keeps its digit registers, so the panel comes back showing
+*  what it did. Nothing is drawn while the timer is stopped. Called from the
+*  main loop.
+*
+*******************************************************************************/
+void DisplayPower(uint8 on)
+{
+    uint8 i;
+    
+    if (!on)
+    {
+        /* A tick already pending would send a frame after the shutdown */
+        DisplayTimer_Stop();
+        Disp_INT_ClearPending();
+    }
     
     CS_Write(LOW);
     CyDelayUs(SPI_DELAY);
     for (i = 0; i < MODULE_COUNT; i++)
     {
-        SendPacketNoCS (MAX7219_REG_INTENSITY, level % 16);  // character intensity: range: 0 to 15
+        SendPacketNoCS (MAX7219_REG_SHUTDOWN, on ? 1 : 0);
     }
     CyDelayUs(SPI_DELAY);
     CS_Write(HIGH);
     CyDelayUs(SPI_DELAY);
+    
+    if (on)
+    {
+        DisplayTimer_Start();
+    }
 }
 
+/* The speed of zone 0, which is also the speed of the ticker and the live
+* stream. Display_ISR puts it on the timer at its next tick. */
 void DispaySpeed(uint8 speed)
 {
-    Timer_CLK_Stop();
-    Timer_CLK_SetDividerValue(255 - (speed % 201));  // character speed: range: 80 to 255
-    Timer_CLK_Start();
+    ZoneSpeed(0, speed);
+}
+
+/* Called by Display_ISR on every tick outside grayscale, which owns the timer
+* clock. Text mode runs at the fastest zone's speed, animations at their own
+* rate, the others at zone 0's. The clock is only touched when the divider
+* changes. */
+void DisplayBaseSpeed(void)
+{
+    uint8 divider;
+    
+    if (displayMode == DISPLAY_MODE_GRAY)
+    {
+        return;
+    }
+    
+    if (displayMode == DISPLAY_MODE_TEXT)
+    {
+        divider = ZoneDivider();
+    }
+    else if ((displayMode == DISPLAY_MODE_ANIM) || (displayMode == DISPLAY_MODE_LIVE) ||
+        (displayMode == DISPLAY_MODE_DRAW))
+    {
+        /* What is written from the main loop is latched on the next tick */
+        divider = ANIM_TIMER_DIVIDER;
+    }
+    else
+    {
+        divider = zones[0].render.baseDivider;
+    }
+    if (divider != Timer_CLK_GetDividerRegister())
+    {
+        Timer_CLK_Stop();
+        Timer_CLK_SetDividerValue(divider);
+        Timer_CLK_Start();
+    }
+}
+
+/* Display_ISR calls per second with a given Timer_CLK divider */
+uint16 DisplayStepRate(uint8 divider)
+{
+    return CYDEV_BCLK__HFCLK__HZ / ((DisplayTimer_TC_PERIOD_VALUE + 1) * (divider + 1));
+}
+
+/* Display_ISR calls per second at the current speed */
+uint16 DisplayTickRate(void)
+{
+    return DisplayStepRate(Timer_CLK_GetDividerRegister());
 }
 
 void StandardDisplayInit(void)
@@ -194,9 +489,14 @@ void StandardDisplayInit(void)
     uint8 col;
     uint8 i = 0;
     
+    gattText.text = (char *)CYBLE_GATT_DB_ATTR_GET_ATTR_GEN_PTR(CYBLE_MESSAGE_MESSAGE_CONTROL_CHAR_HANDLE);
+    FramebufferInit();
+    ZoneInit();
+    
     CS_Write(HIGH);
     MAX7219_Start();
     DispaySpeed(200);         // 0 - Slowest, 200 - Fastest
+    DisplayBaseSpeed();
     DisplayTimer_Start();
     Disp_INT_StartEx(Display_ISR);
 
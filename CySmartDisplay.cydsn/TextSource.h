@@ -0,0 +1,51 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _TEXTSOURCE_H_
+#define _TEXTSOURCE_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Text Source Defines
+*******************************************************************************/
+#define TEXT_SOURCE_GATT    0   // MESSAGE Control value in the GATT DB, owned by the BLE write path
+#define TEXT_SOURCE_FLASH   1   // const text in flash, never changes
+#define TEXT_SOURCE_RAM     2   // caller-owned RAM, must stay valid and unchanged while shown
+#define TEXT_SOURCE_PACKED  3   // LZ stream unpacked as it scrolls; length is the unpacked length
+
+/* The renderer never copies text: it reads characters through the active
+* descriptor. Descriptors must outlive their use, so pass static ones.
+* To change RAM text, edit it only after another descriptor is active, or
+* call DisplayText again after the edit to restart the scroll. */
+typedef struct
+{
+    const char *text;
+    uint16 length;
+    uint8 source;
+} TEXT_DESC_T;
+
+/* Characters of a text that fit in MESSAGE Control, all of it unless packed */
+#define TEXT_ATTR_LENGTH(desc)  (((desc)->length < MESSAGE_SIZE) ? (uint8)(desc)->length : MESSAGE_SIZE)
+
+extern const TEXT_DESC_T * volatile activeText;
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void DisplayText(const TEXT_DESC_T *desc);
+void DisplayPacked(const uint8 *stream, uint8 size, uint16 length);
+void DisplayPaged(uint8 hold);
+void SyncMessageAttribute(void);
+void MessageSplice(uint8 offset, uint8 remove, const char *data, uint8 length);
+
+#endif
+/* [] END OF FILE */
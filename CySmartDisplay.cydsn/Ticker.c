@@ -0,0 +1,223 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Ticker.h>
+#include <Glyph.h>
+#include <Zone.h>
+
+/* Single producer (main loop) and single consumer (Display_ISR). head and
+* tail run freely and are masked on access, so head - tail is the fill level
+* and each side only ever writes its own index. */
+static char ring[TICKER_SIZE];
+static volatile uint16 head = 0;
+static volatile uint16 tail = 0;
+
+/* The character being scrolled in, laid out like a zone's cell (Render.h) */
+static uint16 current;
+static uint8 column = 0;
+static uint8 first = 0;
+static uint8 width = 0;
+static uint8 advance = 0;
+static volatile uint16 underruns = 0;
+static uint8 state = TICKER_READY;
+
+static void TickerStart(void)
+{
+    uint8 intrStatus = CyEnterCriticalSection();
+    
+    head = 0;
+    tail = 0;
+    column = 0;
+    advance = 0;
+    underruns = 0;
+    state = TICKER_READY;
+    displayMode = DISPLAY_MODE_TICKER;
+    
+    CyExitCriticalSection(intrStatus);
+}
+
+/* Appends what fits of 'data' to the ring, or nothing unless 'partial' */
+static CYBLE_GATT_ERR_CODE_T Append(const uint8 *data, uint16 length, uint8 partial)
+{
+    uint16 space = TICKER_SIZE - (uint16)(head - tail);
+    uint16 i;
+    
+    if (length > space)
+    {
+        if (!partial)
+        {
+            return CYBLE_GATT_ERR_INSUFFICIENT_RESOURCE;
+        }
+        length = space;
+    }
+    
+    for (i = 0; i < length; i++)
+    {
+        ring[(head + i) & (TICKER_SIZE - 1)] = data[i];
+    }
+    head += length;
+    
+    return CYBLE_GATT_ERR_NONE;
+}
+
+/*******************************************************************************
+* Function Name: TickerWrite
+********************************************************************************
+*
+* Summary:
+*  Appends text written to TICKER Control to the ticker ring. The first
+*  write switches the display to ticker mode with an empty ring; after that
+*  the text keeps scrolling while more is added behind it.
+*
+* Parameters:
+*  const uint8 *data: Characters to append.
+*  uint16 length:     Number of characters.
+*  uint8 partial:     TRUE to keep whatever fits when the ring is too full, as
+*                     for write-without-response. FALSE rejects the whole
+*                     write instead.
+*
+* Return:
+*  CYBLE_GATT_ERR_NONE, or CYBLE_GATT_ERR_INSUFFICIENT_RESOURCE if nothing
+*  was appended because it would not fit.
+*
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T TickerWrite(const uint8 *data, uint16 length, uint8 partial)
+{
+    if (displayMode != DISPLAY_MODE_TICKER)
+    {
+        TickerStart();
+    }
+    return Append(data, length, partial);
+}
+
+/*******************************************************************************
+* Function Name: TickerNext
+********************************************************************************
+*
+* Summary:
+*  Called from Display_ISR for every column in ticker mode. Steps through the
+*  columns of the current character and takes the next one off the ring when
+*  it is done, freeing its bytes for the producers. The text is UTF-8 and a
+*  character is only taken once all of its bytes have arrived. Characters are
+*  as wide as in zone 0, proportional unless its spacing is RENDER_FIXED.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  The column to scroll in. On an underrun, when the ring held no whole
+*  character at a character boundary, it is blank and the next character
+*  starts cleanly.
+*
+*******************************************************************************/
+uint8 TickerNext(void)
+{
+    uint8 spacing = zones[0].render.spacing;
+    uint8 bytes[4];
+    uint8 n, size, extent;
+    
+    if (column >= advance)
+    {
+        for (n = 0; (n < 4) && ((uint16)(head - tail) > n); n++)
+        {
+            bytes[n] = ring[(tail + n) & (TICKER_SIZE - 1)];
+        }
+        current = (n != 0) ? Utf8Decode(bytes, n, &size) : 0;
+        if ((n == 0) || (size == 0))
+        {
+            underruns++;
+            return 0;
+        }
+        tail += size;
+        column = 0;
+        
+        extent = (spacing == RENDER_FIXED) ? 0x08 : GlyphExtent(current);
+        first = FONT_EXTENT_FIRST(extent);
+        width = FONT_EXTENT_WIDTH(extent);
+        advance = width + ((spacing == RENDER_FIXED) ? 0 : spacing);
+    }
+    
+    column++;
+    return (column <= width) ? GlyphColumns(current)[first + column - 1] : 0;
+}
+
+/* Refreshes the status held in TICKER Control so a read sees current values */
+void TickerSyncAttribute(void)
+{
+    uint8 *value = CYBLE_GATT_DB_ATTR_GET_ATTR_GEN_PTR(CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE);
+    uint16 space = TICKER_SIZE - (uint16)(head - tail);
+    uint16 columns = underruns;
+    
+    value[0] = state;
+    value[1] = LO8(space);
+    value[2] = HI8(space);
+    value[3] = LO8(columns);
+    value[4] = HI8(columns);
+    CYBLE_GATT_DB_ATTR_SET_ATTR_GEN_LEN(CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE, TICKER_STATUS_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: TickerService
+********************************************************************************
+*
+* Summary:
+*  Called from the main loop. In ticker mode, feeds bytes received on the
+*  UART into the ring and signals backpressure: TICKER Control notifies BUSY
+*  when the ring can no longer be sure to take a full write, and READY once
+*  the scroll has drained it to the low water mark. The gap between the two
+*  keeps it from chattering. Only a write to TICKER Control starts ticker
+*  mode; UART bytes that arrive in any other mode are dropped, so line noise
+*  never takes the panel over and stale text is not shown later.
+*
+*******************************************************************************/
+void TickerService(void)
+{
+    CYBLE_GATT_HANDLE_VALUE_PAIR_T status;
+    uint16 used;
+    uint8 byte;
+    
+    if (displayMode != DISPLAY_MODE_TICKER)
+    {
+        UART_SpiUartClearRxBuffer();
+        return;
+    }
+    while ((UART_SpiUartGetRxBufferSize() != 0) && ((uint16)(head - tail) < TICKER_SIZE))
+    {
+        byte = (uint8)UART_UartGetChar();
+        Append(&byte, 1, TRUE);
+    }
+    
+    used = head - tail;
+    if ((state == TICKER_READY) && (used >= TICKER_HIGH_WATER))
+    {
+        state = TICKER_BUSY;
+    }
+    else if ((state == TICKER_BUSY) && (used <= TICKER_LOW_WATER))
+    {
+        state = TICKER_READY;
+    }
+    else
+    {
+        return;
+    }
+    
+    TickerSyncAttribute();
+    if (deviceConnected &&
+        CYBLE_IS_NOTIFICATION_ENABLED(CYBLE_MESSAGE_TICKER_CONTROL_CLIENT_CHARACTERISTIC_CONFIGURATION_DESC_HANDLE))
+    {
+        status.attrHandle = CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE;
+        status.value.val = CYBLE_GATT_DB_ATTR_GET_ATTR_GEN_PTR(CYBLE_MESSAGE_TICKER_CONTROL_CHAR_HANDLE);
+        status.value.len = TICKER_STATUS_SIZE;
+        CyBle_GattsNotification(cyBle_connHandle, &status);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,37 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _TICKER_H_
+#define _TICKER_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Ticker Defines
+*******************************************************************************/
+#define TICKER_SIZE         256     // ring size, must be a power of two
+#define TICKER_HIGH_WATER   (TICKER_SIZE - MESSAGE_SIZE)   // busy once a full write may not fit
+#define TICKER_LOW_WATER    (TICKER_SIZE / 4)              // ready again when drained to here
+
+#define TICKER_READY        0
+#define TICKER_BUSY         1
+#define TICKER_STATUS_SIZE  5       // [state] [free space] [underrun columns], little-endian
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+CYBLE_GATT_ERR_CODE_T TickerWrite(const uint8 *data, uint16 length, uint8 partial);
+uint8 TickerNext(void);
+void TickerSyncAttribute(void);
+void TickerService(void);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,182 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Var.h>
+#include <Clock.h>
+
+typedef struct
+{
+    char name[VAR_NAME_SIZE];
+    uint8 nameLength;
+    char value[VAR_VALUE_SIZE];
+    uint8 length;
+    uint8 version;          // changes with the value
+    uint8 set;              // TRUE once a write set it
+    uint8 refs;             // ops of compiled programs that show it
+} VAR_T;
+
+static VAR_T vars[VAR_COUNT] =
+{
+    { "time", 4, "", 0, 0, TRUE, 0 },
+    { "date", 4, "", 0, 0, TRUE, 0 },
+};
+static uint8 varCount = VAR_BUILT_IN;
+
+uint8 VarNameValid(const char *name, uint8 length)
+{
+    uint8 i;
+    
+    if ((length == 0) || (length > VAR_NAME_SIZE))
+    {
+        return FALSE;
+    }
+    for (i = 0; i < length; i++)
+    {
+        if (!(((name[i] >= 'a') && (name[i] <= 'z')) || ((name[i] >= '0') && (name[i] <= '9')) || (name[i] == '_')))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* An entry nothing needs: never set, and shown by no compiled program */
+static uint8 Spare(void)
+{
+    uint8 i;
+    
+    for (i = VAR_BUILT_IN; i < varCount; i++)
+    {
+        if (!vars[i].set && (vars[i].refs == 0))
+        {
+            return i;
+        }
+    }
+    return (varCount < VAR_COUNT) ? varCount++ : VAR_NONE;
+}
+
+/* The entry for 'name', given one first if 'add' is set and there is room.
+* Returns VAR_NONE if there is none. */
+uint8 VarFind(const char *name, uint8 length, uint8 add)
+{
+    uint8 i;
+    
+    for (i = 0; i < varCount; i++)
+    {
+        if ((vars[i].nameLength == length) && (memcmp(vars[i].name, name, length) == 0))
+        {
+            return i;
+        }
+    }
+    if (!add || !VarNameValid(name, length))
+    {
+        return VAR_NONE;
+    }
+    i = Spare();
+    if (i != VAR_NONE)
+    {
+        memcpy(vars[i].name, name, length);
+        vars[i].nameLength = length;
+        vars[i].length = 0;
+        vars[i].set = FALSE;
+    }
+    return i;
+}
+
+/* Names that could still be given an entry */
+uint8 VarRoom(void)
+{
+    uint8 room = VAR_COUNT - varCount;
+    uint8 i;
+    
+    for (i = VAR_BUILT_IN; i < varCount; i++)
+    {
+        room += !vars[i].set && (vars[i].refs == 0);
+    }
+    return room;
+}
+
+/* Counts the ops of compiled programs that show entry 'id', so it is not
+* given to another name while they do. Called by the renderer. */
+void VarRefer(uint8 id)
+{
+    vars[id].refs++;
+}
+
+void VarRelease(uint8 id)
+{
+    if (vars[id].refs != 0)
+    {
+        vars[id].refs--;
+    }
+}
+
+/*******************************************************************************
+* Function Name: VarSet
+********************************************************************************
+*
+* Summary:
+*  Sets variable 'name' to 'value', at most VAR_VALUE_SIZE bytes. Called from
+*  CommandApply, on a frame boundary, so the renderer never reads a value
+*  half written. Setting the value it already has changes nothing.
+*
+* Return:
+*  FALSE if the name is built in, or new and the table is full.
+*
+*******************************************************************************/
+uint8 VarSet(const char *name, uint8 nameLength, const char *value, uint8 length)
+{
+    uint8 id = VarFind(name, nameLength, TRUE);
+    VAR_T *v;
+    
+    if ((id == VAR_NONE) || (id < VAR_BUILT_IN))
+    {
+        return FALSE;
+    }
+    v = &vars[id];
+    v->set = TRUE;
+    if ((v->length != length) || (memcmp(v->value, value, length) != 0))
+    {
+        memcpy(v->value, value, length);
+        v->length = length;
+        v->version++;
+    }
+    return TRUE;
+}
+
+/* Copies the value of entry 'id' into 'value', which must hold
+* VAR_VALUE_SIZE bytes, and returns its length */
+uint8 VarValue(uint8 id, char *value)
+{
+    if (id == VAR_TIME)
+    {
+        return ClockFormat(CLOCK_HHMM, value);
+    }
+    if (id == VAR_DATE)
+    {
+        return ClockFormat(CLOCK_DATE, value);
+    }
+    memcpy(value, vars[id].value, vars[id].length);
+    return vars[id].length;
+}
+
+/* Changes whenever the value of entry 'id' does; the built in ones change
+* once a minute */
+uint8 VarVersion(uint8 id)
+{
+    if (id < VAR_BUILT_IN)
+    {
+        return (uint8)((ClockNow() / 60u) + ClockSynced());
+    }
+    return vars[id].version;
+}
+
+/* [] END OF FILE */
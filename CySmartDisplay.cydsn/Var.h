@@ -0,0 +1,54 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _VAR_H_
+#define _VAR_H_
+
+#include <main.h>
+
+/*******************************************************************************
+* Var Defines
+*******************************************************************************/
+/* Named values a message refers to as {name} (Render.h). A value is set by
+* name with the VAR record of COMMAND Control and takes effect without the
+* message being sent or compiled again: the renderer reads it as the scroll
+* reaches it, and a still run that shows one is redrawn when it changes.
+*
+* Names are 1 to VAR_NAME_SIZE of a-z, 0-9 and '_'. A name gets an entry the
+* first time a message or a write uses it. An entry a write set keeps its
+* value until the reset; one only a message named is given back once no
+* compiled message refers to it, so text such as {ok} does not fill the
+* table. A name that finds the table full is shown as typed, and a write
+* that would need one is refused. {time} and {date} are kept by the device
+* from the clock (Clock.h) and cannot be set. */
+#define VAR_COUNT           8
+#define VAR_NAME_SIZE       8
+#define VAR_VALUE_SIZE      16      // bytes of UTF-8
+#define VAR_NONE            0xFF
+
+#define VAR_TIME            0       // 09:41
+#define VAR_DATE            1       // 18.10.26
+#define VAR_BUILT_IN        2       // entries before this are kept by the device
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+uint8 VarNameValid(const char *name, uint8 length);
+uint8 VarFind(const char *name, uint8 length, uint8 add);
+uint8 VarRoom(void);
+void VarRefer(uint8 id);
+void VarRelease(uint8 id);
+uint8 VarSet(const char *name, uint8 nameLength, const char *value, uint8 length);
+uint8 VarValue(uint8 id, char *value);
+uint8 VarVersion(uint8 id);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,314 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Zone.h>
+#include <Framebuffer.h>
+
+ZONE_T zones[ZONE_COUNT];
+
+static const TEXT_DESC_T emptyText = { "", 0, TEXT_SOURCE_FLASH };
+
+/* Text for zones other than 0, copied from the COMMAND batch */
+static char zoneStore[ZONE_COUNT - 1][ZONE_TEXT_SIZE];
+static TEXT_DESC_T zoneText[ZONE_COUNT - 1];
+
+/* Works out the size the zone can show its text at and the columns its
+* renderer draws: a scaled zone renders one row of modules, narrowed by the
+* scale, and is stretched over its rows as it is composited */
+static void Fit(ZONE_T *z)
+{
+    uint8 height = SCALE_HEIGHT(z->size);
+    
+    z->drawn = z->size;
+    if ((height > 1) && (((z->first % FB_WIDTH) != 0) || (z->columns < (height * FB_WIDTH))))
+    {
+        z->drawn = SCALE_1X;
+    }
+    z->render.first = z->first;
+    z->render.width = (z->drawn == SCALE_1X) ? z->columns :
+        ((FB_WIDTH + SCALE_WIDTH(z->drawn) - 1) / SCALE_WIDTH(z->drawn));
+}
+
+void ZoneInit(void)
+{
+    uint8 i;
+    
+    memset(zones, 0, sizeof(zones));
+    for (i = 0; i < ZONE_COUNT; i++)
+    {
+        zones[i].render.baseDivider = 255 - 200;
+        zones[i].render.spacing = RENDER_SPACING;
+        zones[i].size = SCALE_1X;
+        zones[i].effect.selected = EFFECT_SCROLL;
+        zones[i].text = &emptyText;
+        if (i > 0)
+        {
+            zoneText[i - 1].text = zoneStore[i - 1];
+            zoneText[i - 1].source = TEXT_SOURCE_RAM;
+        }
+    }
+    zones[0].modules = MODULE_COUNT;
+    zones[0].columns = FB_COLUMNS;
+    Fit(&zones[0]);
+    ZoneStart(0, &emptyText);
+}
+
+/* A layout needs zone 0 and must fit on the chain */
+uint8 ZoneLayoutValid(const uint8 *modules)
+{
+    uint8 total = 0;
+    uint8 i;
+    
+    for (i = 0; i < ZONE_COUNT; i++)
+    {
+        if (modules[i] > MODULE_COUNT)
+        {
+            return FALSE;
+        }
+        total += modules[i];
+    }
+    return (modules[0] != 0) && (total <= MODULE_COUNT);
+}
+
+/*******************************************************************************
+* Function Name: ZoneLayout
+********************************************************************************
+*
+* Summary:
+*  Splits the panel into zones, left to right. Every zone in the layout starts
+*  its text over in its new columns; modules left over are blanked. The
+*  layout must have passed ZoneLayoutValid.
+*
+* Parameters:
+*  modules: modules in each of the ZONE_COUNT zones, 0 to leave a zone out
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ZoneLayout(const uint8 *modules)
+{
+    uint8 total = 0;
+    uint8 i;
+    
+    for (i = 0; i < ZONE_COUNT; i++)
+    {
+        zones[i].modules = modules[i];
+        zones[i].first = total * 8;
+        zones[i].columns = modules[i] * 8;
+        Fit(&zones[i]);
+        zones[i].accum = 0;
+        total += modules[i];
+        if (modules[i] != 0)
+        {
+            ZoneStart(i, zones[i].text);
+        }
+    }
+    
+    while (total < MODULE_COUNT)
+    {
+        static const uint8 blank[8] = {0};
+        
+        FramebufferWrite(total * 8, blank, 8);
+        FramebufferModuleIntensity(total, 1, fbBrightness);
+        total++;
+    }
+}
+
+/* Starts a text over in its zone, with the zone's effect */
+void ZoneStart(uint8 zone, const TEXT_DESC_T *text)
+{
+    ZONE_T *z = &zones[zone];
+    
+    z->text = text;
+    if (z->modules == 0)
+    {
+        /* Kept until the layout brings the zone in */
+        return;
+    }
+    
+    RenderStart(&z->render, text);
+    if (z->drawn != SCALE_1X)
+    {
+        /* What the panel shows is stretched; start from a blank zone */
+        memset(z->render.window, 0, z->render.width);
+    }
+    z->effect.first = z->first;
+    z->effect.width = z->columns;
+    z->effect.rate = DisplayStepRate(z->render.baseDivider);
+    EffectStart(&z->effect);
+    z->render.changed = TRUE;
+}
+
+/* Starts the text of every zone in the layout over, after something it may
+* draw changed */
+void ZoneRefresh(void)
+{
+    uint8 i;
+    
+    for (i = 0; i < ZONE_COUNT; i++)
+    {
+        ZoneStart(i, zones[i].text);
+    }
+}
+
+/* New text for a zone other than 0. Called from Display_ISR, so the copy
+* cannot race the renderer reading it. */
+void ZoneMessage(uint8 zone, const char *text, uint8 length)
+{
+    TEXT_DESC_T *desc;
+    
+    if ((zone == 0) || (zone >= ZONE_COUNT))
+    {
+        return;
+    }
+    desc = &zoneText[zone - 1];
+    if (length > ZONE_TEXT_SIZE)
+    {
+        length = ZONE_TEXT_SIZE;
+    }
+    
+    memcpy(zoneStore[zone - 1], text, length);
+    desc->length = length;
+    ZoneStart(zone, desc);
+}
+
+/* Same range as SPEED Control. Display_ISR moves the timer to the fastest
+* zone on its next tick. */
+void ZoneSpeed(uint8 zone, uint8 speed)
+{
+    RENDER_T *r = &zones[zone].render;
+    
+    r->baseDivider = 255 - (speed % 201);
+    r->divider = r->baseDivider;
+    zones[zone].effect.rate = DisplayStepRate(r->baseDivider);
+}
+
+/* Blank columns between characters, or RENDER_FIXED. The text starts over so
+* static runs are measured again. */
+void ZoneSpacing(uint8 zone, uint8 spacing)
+{
+    zones[zone].render.spacing = spacing;
+    ZoneStart(zone, zones[zone].text);
+}
+
+/* A SCALE_ size for the zone's text; the text starts over at it */
+void ZoneSize(uint8 zone, uint8 size)
+{
+    zones[zone].size = size;
+    Fit(&zones[zone]);
+    ZoneStart(zone, zones[zone].text);
+}
+
+void ZoneEffect(uint8 zone, uint8 id)
+{
+    ZONE_T *z = &zones[zone];
+    
+    EffectSelect(&z->effect, id);
+    z->render.changed = TRUE;   // redraw in case an effect was turned off
+}
+
+/* Timer_CLK divider for text mode: the fastest zone steps on every tick */
+uint8 ZoneDivider(void)
+{
+    uint8 divider = 255;
+    uint8 i;
+    
+    for (i = 0; i < ZONE_COUNT; i++)
+    {
+        if ((zones[i].modules != 0) && (zones[i].render.divider < divider))
+        {
+            divider = zones[i].render.divider;
+        }
+    }
+    return divider;
+}
+
+/*******************************************************************************
+* Function Name: ZoneTick
+********************************************************************************
+*
+* Summary:
+*  Called from Display_ISR once per tick in text mode, with the timer at
+*  ZoneDivider. Each tick is worth (divider + 1) to every zone, and a zone
+*  steps once it is owed its own divider + 1, so slower zones step on some
+*  ticks only. A zone that did not step, or stepped without changing, is not
+*  composited; one that did is written into its columns of the framebuffer,
+*  where only digits that differ are marked for the commit. Scaled text is
+*  stretched on the way, a table lookup per rendered column.
+*
+* Parameters:
+*  None
+*
+* Return:
+*  None
+*
+*******************************************************************************/
+void ZoneTick(void)
+{
+    uint16 tick = ZoneDivider() + 1u;
+    uint8 scene[FB_COLUMNS];
+    uint8 shown[FB_WIDTH];
+    uint16 period;
+    ZONE_T *z;
+    uint8 i;
+    
+    for (i = 0; i < ZONE_COUNT; i++)
+    {
+        z = &zones[i];
+        if (z->modules == 0)
+        {
+            continue;
+        }
+        
+        period = z->render.divider + 1u;
+        z->accum += tick;
+        if (z->accum < period)
+        {
+            continue;
+        }
+        z->accum -= period;
+        if (z->accum >= period)
+        {
+            /* The zone sped up with <sN>: drop what it can no longer use */
+            z->accum = 0;
+        }
+        
+        RenderTick(&z->render);
+        if (!z->render.changed && !z->effect.active)
+        {
+            continue;
+        }
+        z->render.changed = FALSE;
+        
+        if (z->drawn == SCALE_1X)
+        {
+            RenderShown(&z->render, scene);
+        }
+        else
+        {
+            /* Rows of the zone below the text stay blank */
+            RenderShown(&z->render, shown);
+            memset(scene, 0, z->columns);
+            ScaleColumns(shown, z->drawn, scene, FB_WIDTH);
+        }
+        if (z->effect.active)
+        {
+            EffectFrame(&z->effect, scene);
+        }
+        else
+        {
+            FramebufferWrite(z->first, scene, z->columns);
+        }
+    }
+}
+
+/* [] END OF FILE */
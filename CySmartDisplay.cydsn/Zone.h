@@ -0,0 +1,66 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _ZONE_H_
+#define _ZONE_H_
+
+#include <main.h>
+#include <TextSource.h>
+#include <Render.h>
+#include <Effect.h>
+#include <Scale.h>
+
+/*******************************************************************************
+* Zone Defines
+*******************************************************************************/
+/* The panel is split left to right into zones of whole modules. Each zone has
+* its own text, speed, effect and renderer, and is composited into its own
+* columns of the framebuffer. Zone 0 shows MESSAGE Control and always has at
+* least one module; the others take text from COMMAND batches with a ZONE
+* record. By default zone 0 covers the whole panel. On a panel with several
+* rows of modules a zone runs on from the end of one row into the next, and
+* a zone of whole rows can show its text 2 or 3 times the size (Scale.h). */
+#define ZONE_COUNT          2       // at most one zone per module
+#define ZONE_TEXT_SIZE      64      // longest text of a zone other than 0
+
+typedef struct
+{
+    RENDER_T render;
+    EFFECT_STATE_T effect;
+    const TEXT_DESC_T *text;
+    uint8 modules;                  // 0 while the zone is not in the layout
+    uint16 first;                   // the zone's columns in the panel; 'render' has
+    uint16 columns;                 // fewer of its own when the text is scaled
+    uint8 size;                     // SCALE_ size asked for
+    uint8 drawn;                    // the size it fits at
+    uint16 accum;                   // timer time owed to the zone, in divider units
+} ZONE_T;
+
+extern ZONE_T zones[ZONE_COUNT];
+
+/*******************************************************************************
+* Function declaration
+*******************************************************************************/
+void ZoneInit(void);
+uint8 ZoneLayoutValid(const uint8 *modules);
+void ZoneLayout(const uint8 *modules);
+void ZoneStart(uint8 zone, const TEXT_DESC_T *text);
+void ZoneRefresh(void);
+void ZoneMessage(uint8 zone, const char *text, uint8 length);
+void ZoneSpeed(uint8 zone, uint8 speed);
+void ZoneSpacing(uint8 zone, uint8 spacing);
+void ZoneSize(uint8 zone, uint8 size);
+void ZoneEffect(uint8 zone, uint8 id);
+uint8 ZoneDivider(void);
+void ZoneTick(void);
+
+#endif
+/* [] END OF FILE */
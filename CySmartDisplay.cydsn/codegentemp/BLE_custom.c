@@ -59,6 +59,86 @@ const CYBLE_CUSTOMS_T cyBle_customs[0x01u] = {
                     CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
                 }, 
             },
+
+            /* FRAMEBUFFER Control characteristic */
+            {
+                0x0014u, /* Handle of the FRAMEBUFFER Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
+                }, 
+            },
+
+            /* COMMAND Control characteristic */
+            {
+                0x0016u, /* Handle of the COMMAND Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
+                }, 
+            },
+
+            /* TICKER Control characteristic */
+            {
+                0x0018u, /* Handle of the TICKER Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    0x0019u, /* Handle of the Client Characteristic Configuration descriptor */ 
+                }, 
+            },
+
+            /* SPRITE Control characteristic */
+            {
+                0x001Bu, /* Handle of the SPRITE Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
+                }, 
+            },
+
+            /* ANIMATION Control characteristic */
+            {
+                0x001Du, /* Handle of the ANIMATION Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
+                }, 
+            },
+
+            /* DRAW Control characteristic */
+            {
+                0x001Fu, /* Handle of the DRAW Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
+                }, 
+            },
+
+            /* CLOCK Control characteristic */
+            {
+                0x0021u, /* Handle of the CLOCK Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
+                }, 
+            },
+
+            /* SCHEDULE Control characteristic */
+            {
+                0x0023u, /* Handle of the SCHEDULE Control characteristic */ 
+                
+                /* Array of Descriptors handles */
+                {
+                    CYBLE_GATT_INVALID_ATTR_HANDLE_VALUE, 
+                }, 
+            },
         }, 
     },
 };
@@ -78,21 +78,21 @@ CYBLE_STATE_T cyBle_state;
         0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
         0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u }, 
         {{
-            0x00u, 0x00u,
+            0x00u, 0x00u, 0x00u, 0x00u,
         },
         {
-            0x00u, 0x00u,
+            0x00u, 0x00u, 0x00u, 0x00u,
         },
         {
-            0x00u, 0x00u,
+            0x00u, 0x00u, 0x00u, 0x00u,
         },
         {
-            0x00u, 0x00u,
+            0x00u, 0x00u, 0x00u, 0x00u,
         },
         {
-            0x00u, 0x00u,
+            0x00u, 0x00u, 0x00u, 0x00u,
         }}, 
-        0x02u, /* CYBLE_GATT_DB_CCCD_COUNT */ 
+        0x04u, /* CYBLE_GATT_DB_CCCD_COUNT */ 
         0x05u, /* CYBLE_GAP_MAX_BONDED_DEVICE */ 
     };
 #endif /* (CYBLE_MODE_PROFILE) */
@@ -108,7 +108,7 @@ CYBLE_STATE_T cyBle_state;
     0x000Bu,    /* Handle of the Client Characteristic Configuration descriptor */
 };
     
-    static uint8 cyBle_attValues[0xD5u] = {
+    static uint8 cyBle_attValues[0x1A2u] = {
     /* Device Name */
     (uint8)'B', (uint8)'i', (uint8)'l', (uint8)'l', (uint8)'b', (uint8)'o', (uint8)'a', (uint8)'r', (uint8)'d',
     (uint8)' ', (uint8)'D', (uint8)'i', (uint8)'s', (uint8)'p', (uint8)'l', (uint8)'a', (uint8)'y',
@@ -142,6 +142,41 @@ CYBLE_STATE_T cyBle_state;
     /* BRIGHTNESS Control */
     0x00u,
 
+    /* FRAMEBUFFER Control */
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+    /* COMMAND Control */
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+    0x00u, 0x00u, 0x00u, 0x00u,
+
+    /* TICKER Control */
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+    /* SPRITE Control */
+    0x00u,
+
+    /* ANIMATION Control */
+    0x00u,
+
+    /* DRAW Control */
+    0x00u,
+
+    /* CLOCK Control */
+    0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+    /* SCHEDULE Control */
+    0x00u,
+
 };
 #if(CYBLE_GATT_DB_CCCD_COUNT != 0u)
 uint8 cyBle_attValuesCCCD[CYBLE_GATT_DB_CCCD_COUNT];
@@ -156,6 +191,22 @@ const uint8 cyBle_attUuid128[][16u] = {
     { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF1u, 0x2Au, 0x00u, 0x00u },
     /* BRIGHTNESS Control */
     { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF2u, 0x2Au, 0x00u, 0x00u },
+    /* FRAMEBUFFER Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF3u, 0x2Au, 0x00u, 0x00u },
+    /* COMMAND Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF4u, 0x2Au, 0x00u, 0x00u },
+    /* TICKER Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF5u, 0x2Au, 0x00u, 0x00u },
+    /* SPRITE Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF6u, 0x2Au, 0x00u, 0x00u },
+    /* ANIMATION Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF7u, 0x2Au, 0x00u, 0x00u },
+    /* DRAW Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF8u, 0x2Au, 0x00u, 0x00u },
+    /* CLOCK Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xF9u, 0x2Au, 0x00u, 0x00u },
+    /* SCHEDULE Control */
+    { 0xFBu, 0x34u, 0x9Bu, 0x5Fu, 0x80u, 0x00u, 0x00u, 0x80u, 0x00u, 0x10u, 0x00u, 0x00u, 0xFAu, 0x2Au, 0x00u, 0x00u },
 };
 
 CYBLE_GATTS_ATT_GEN_VAL_LEN_T cyBle_attValuesLen[CYBLE_GATT_DB_ATT_VAL_COUNT] = {
@@ -171,27 +222,61 @@ CYBLE_GATTS_ATT_GEN_VAL_LEN_T cyBle_attValuesLen[CYBLE_GATT_DB_ATT_VAL_COUNT] =
     { 0x0001u, (void *)&cyBle_attValues[211] }, /* SPEED Control */
     { 0x0010u, (void *)&cyBle_attUuid128[3] }, /* BRIGHTNESS Control UUID */
     { 0x0001u, (void *)&cyBle_attValues[212] }, /* BRIGHTNESS Control */
+    { 0x0010u, (void *)&cyBle_attUuid128[4] }, /* FRAMEBUFFER Control UUID */
+    { 0x0008u, (void *)&cyBle_attValues[213] }, /* FRAMEBUFFER Control */
+    { 0x0010u, (void *)&cyBle_attUuid128[5] }, /* COMMAND Control UUID */
+    { 0x00B4u, (void *)&cyBle_attValues[221] }, /* COMMAND Control */
+    { 0x0010u, (void *)&cyBle_attUuid128[6] }, /* TICKER Control UUID */
+    { 0x0005u, (void *)&cyBle_attValues[401] }, /* TICKER Control */
+    { 0x0002u, (void *)&cyBle_attValuesCCCD[2] }, /* Client Characteristic Configuration */
+    { 0x0010u, (void *)&cyBle_attUuid128[7] }, /* SPRITE Control UUID */
+    { 0x0001u, (void *)&cyBle_attValues[406] }, /* SPRITE Control */
+    { 0x0010u, (void *)&cyBle_attUuid128[8] }, /* ANIMATION Control UUID */
+    { 0x0001u, (void *)&cyBle_attValues[407] }, /* ANIMATION Control */
+    { 0x0010u, (void *)&cyBle_attUuid128[9] }, /* DRAW Control UUID */
+    { 0x0001u, (void *)&cyBle_attValues[408] }, /* DRAW Control */
+    { 0x0010u, (void *)&cyBle_attUuid128[10] }, /* CLOCK Control UUID */
+    { 0x0008u, (void *)&cyBle_attValues[409] }, /* CLOCK Control */
+    { 0x0010u, (void *)&cyBle_attUuid128[11] }, /* SCHEDULE Control UUID */
+    { 0x0001u, (void *)&cyBle_attValues[417] }, /* SCHEDULE Control */
 };
 
-const CYBLE_GATTS_DB_T cyBle_gattDB[0x12u] = {
-    { 0x0001u, 0x2800u /* Primary service                     */, 0x00000001u /*        */, 0x0007u, {{0x1800u, NULL}}                           },
-    { 0x0002u, 0x2803u /* Characteristic                      */, 0x00020001u /* rd     */, 0x0003u, {{0x2A00u, NULL}}                           },
-    { 0x0003u, 0x2A00u /* Device Name                         */, 0x01020001u /* rd     */, 0x0003u, {{0x0011u, (void *)&cyBle_attValuesLen[0]}} },
-    { 0x0004u, 0x2803u /* Characteristic                      */, 0x00020001u /* rd     */, 0x0005u, {{0x2A01u, NULL}}                           },
-    { 0x0005u, 0x2A01u /* Appearance                          */, 0x01020001u /* rd     */, 0x0005u, {{0x0002u, (void *)&cyBle_attValuesLen[1]}} },
-    { 0x0006u, 0x2803u /* Characteristic                      */, 0x00020001u /* rd     */, 0x0007u, {{0x2A04u, NULL}}                           },
-    { 0x0007u, 0x2A04u /* Peripheral Preferred Connection Par */, 0x01020001u /* rd     */, 0x0007u, {{0x0008u, (void *)&cyBle_attValuesLen[2]}} },
-    { 0x0008u, 0x2800u /* Primary service                     */, 0x00000001u /*        */, 0x000Bu, {{0x1801u, NULL}}                           },
-    { 0x0009u, 0x2803u /* Characteristic                      */, 0x00220001u /* rd,ind */, 0x000Bu, {{0x2A05u, NULL}}                           },
-    { 0x000Au, 0x2A05u /* Service Changed                     */, 0x01220001u /* rd,ind */, 0x000Bu, {{0x0004u, (void *)&cyBle_attValuesLen[3]}} },
-    { 0x000Bu, 0x2902u /* Client Characteristic Configuration */, 0x010A0101u /* rd,wr  */, 0x000Bu, {{0x0002u, (void *)&cyBle_attValuesLen[4]}} },
-    { 0x000Cu, 0x2800u /* Primary service                     */, 0x08000001u /*        */, 0x0012u, {{0x0010u, (void *)&cyBle_attValuesLen[5]}} },
-    { 0x000Du, 0x2803u /* Characteristic                      */, 0x000A0001u /* rd,wr  */, 0x000Eu, {{0x0010u, (void *)&cyBle_attValuesLen[6]}} },
-    { 0x000Eu, 0x2AF0u /* MESSAGE Control                     */, 0x090A0101u /* rd,wr  */, 0x000Eu, {{0x00B4u, (void *)&cyBle_attValuesLen[7]}} },
-    { 0x000Fu, 0x2803u /* Characteristic                      */, 0x00080001u /* wr     */, 0x0010u, {{0x0010u, (void *)&cyBle_attValuesLen[8]}} },
-    { 0x0010u, 0x2AF1u /* SPEED Control                       */, 0x09080100u /* wr     */, 0x0010u, {{0x0001u, (void *)&cyBle_attValuesLen[9]}} },
-    { 0x0011u, 0x2803u /* Characteristic                      */, 0x00080001u /* wr     */, 0x0012u, {{0x0010u, (void *)&cyBle_attValuesLen[10]}} },
-    { 0x0012u, 0x2AF2u /* BRIGHTNESS Control                  */, 0x09080100u /* wr     */, 0x0012u, {{0x0001u, (void *)&cyBle_attValuesLen[11]}} },
+const CYBLE_GATTS_DB_T cyBle_gattDB[0x23u] = {
+    { 0x0001u, 0x2800u /* Primary service                     */, 0x00000001u /*               */, 0x0007u, {{0x1800u, NULL}}                           },
+    { 0x0002u, 0x2803u /* Characteristic                      */, 0x00020001u /* rd            */, 0x0003u, {{0x2A00u, NULL}}                           },
+    { 0x0003u, 0x2A00u /* Device Name                         */, 0x01020001u /* rd            */, 0x0003u, {{0x0011u, (void *)&cyBle_attValuesLen[0]}} },
+    { 0x0004u, 0x2803u /* Characteristic                      */, 0x00020001u /* rd            */, 0x0005u, {{0x2A01u, NULL}}                           },
+    { 0x0005u, 0x2A01u /* Appearance                          */, 0x01020001u /* rd            */, 0x0005u, {{0x0002u, (void *)&cyBle_attValuesLen[1]}} },
+    { 0x0006u, 0x2803u /* Characteristic                      */, 0x00020001u /* rd            */, 0x0007u, {{0x2A04u, NULL}}                           },
+    { 0x0007u, 0x2A04u /* Peripheral Preferred Connection Par */, 0x01020001u /* rd            */, 0x0007u, {{0x0008u, (void *)&cyBle_attValuesLen[2]}} },
+    { 0x0008u, 0x2800u /* Primary service                     */, 0x00000001u /*               */, 0x000Bu, {{0x1801u, NULL}}                           },
+    { 0x0009u, 0x2803u /* Characteristic                      */, 0x00220001u /* rd,ind        */, 0x000Bu, {{0x2A05u, NULL}}                           },
+    { 0x000Au, 0x2A05u /* Service Changed                     */, 0x01220001u /* rd,ind        */, 0x000Bu, {{0x0004u, (void *)&cyBle_attValuesLen[3]}} },
+    { 0x000Bu, 0x2902u /* Client Characteristic Configuration */, 0x010A0101u /* rd,wr         */, 0x000Bu, {{0x0002u, (void *)&cyBle_attValuesLen[4]}} },
+    { 0x000Cu, 0x2800u /* Primary service                     */, 0x08000001u /*               */, 0x0023u, {{0x0010u, (void *)&cyBle_attValuesLen[5]}} },
+    { 0x000Du, 0x2803u /* Characteristic                      */, 0x000A0001u /* rd,wr         */, 0x000Eu, {{0x0010u, (void *)&cyBle_attValuesLen[6]}} },
+    { 0x000Eu, 0x2AF0u /* MESSAGE Control                     */, 0x090A0101u /* rd,wr         */, 0x000Eu, {{0x00B4u, (void *)&cyBle_attValuesLen[7]}} },
+    { 0x000Fu, 0x2803u /* Characteristic                      */, 0x00080001u /* wr            */, 0x0010u, {{0x0010u, (void *)&cyBle_attValuesLen[8]}} },
+    { 0x0010u, 0x2AF1u /* SPEED Control                       */, 0x09080100u /* wr            */, 0x0010u, {{0x0001u, (void *)&cyBle_attValuesLen[9]}} },
+    { 0x0011u, 0x2803u /* Characteristic                      */, 0x00080001u /* wr            */, 0x0012u, {{0x0010u, (void *)&cyBle_attValuesLen[10]}} },
+    { 0x0012u, 0x2AF2u /* BRIGHTNESS Control                  */, 0x09080100u /* wr            */, 0x0012u, {{0x0001u, (void *)&cyBle_attValuesLen[11]}} },
+    { 0x0013u, 0x2803u /* Characteristic                      */, 0x00060001u /* rd,wwr        */, 0x0014u, {{0x0010u, (void *)&cyBle_attValuesLen[12]}} },
+    { 0x0014u, 0x2AF3u /* FRAMEBUFFER Control                 */, 0x09060101u /* rd,wwr        */, 0x0014u, {{0x0008u, (void *)&cyBle_attValuesLen[13]}} },
+    { 0x0015u, 0x2803u /* Characteristic                      */, 0x00080001u /* wr            */, 0x0016u, {{0x0010u, (void *)&cyBle_attValuesLen[14]}} },
+    { 0x0016u, 0x2AF4u /* COMMAND Control                     */, 0x09080100u /* wr            */, 0x0016u, {{0x00B4u, (void *)&cyBle_attValuesLen[15]}} },
+    { 0x0017u, 0x2803u /* Characteristic                      */, 0x001E0001u /* rd,wr,wwr,ntf */, 0x0019u, {{0x0010u, (void *)&cyBle_attValuesLen[16]}} },
+    { 0x0018u, 0x2AF5u /* TICKER Control                      */, 0x091E0101u /* rd,wr,wwr,ntf */, 0x0019u, {{0x0005u, (void *)&cyBle_attValuesLen[17]}} },
+    { 0x0019u, 0x2902u /* Client Characteristic Configuration */, 0x010A0101u /* rd,wr         */, 0x0019u, {{0x0002u, (void *)&cyBle_attValuesLen[18]}} },
+    { 0x001Au, 0x2803u /* Characteristic                      */, 0x00080001u /* wr            */, 0x001Bu, {{0x0010u, (void *)&cyBle_attValuesLen[19]}} },
+    { 0x001Bu, 0x2AF6u /* SPRITE Control                      */, 0x09080100u /* wr            */, 0x001Bu, {{0x0001u, (void *)&cyBle_attValuesLen[20]}} },
+    { 0x001Cu, 0x2803u /* Characteristic                      */, 0x00080001u /* wr            */, 0x001Du, {{0x0010u, (void *)&cyBle_attValuesLen[21]}} },
+    { 0x001Du, 0x2AF7u /* ANIMATION Control                   */, 0x09080100u /* wr            */, 0x001Du, {{0x0001u, (void *)&cyBle_attValuesLen[22]}} },
+    { 0x001Eu, 0x2803u /* Characteristic                      */, 0x000C0001u /* wr,wwr        */, 0x001Fu, {{0x0010u, (void *)&cyBle_attValuesLen[23]}} },
+    { 0x001Fu, 0x2AF8u /* DRAW Control                        */, 0x090C0100u /* wr,wwr        */, 0x001Fu, {{0x0001u, (void *)&cyBle_attValuesLen[24]}} },
+    { 0x0020u, 0x2803u /* Characteristic                      */, 0x000A0001u /* rd,wr         */, 0x0021u, {{0x0010u, (void *)&cyBle_attValuesLen[25]}} },
+    { 0x0021u, 0x2AF9u /* CLOCK Control                       */, 0x090A0101u /* rd,wr         */, 0x0021u, {{0x0008u, (void *)&cyBle_attValuesLen[26]}} },
+    { 0x0022u, 0x2803u /* Characteristic                      */, 0x00080001u /* wr            */, 0x0023u, {{0x0010u, (void *)&cyBle_attValuesLen[27]}} },
+    { 0x0023u, 0x2AFAu /* SCHEDULE Control                    */, 0x09080100u /* wr            */, 0x0023u, {{0x0001u, (void *)&cyBle_attValuesLen[28]}} },
 };
 
 
@@ -0,0 +1,537 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <Glyph.h>
+
+// accent marks added to a base glyph, one byte per column, bit 0 at the top
+const uint8 glyphMarks [GLYPH_MARK_COUNT] [8] = {
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // none
+  { 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00 }, // acute
+  { 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 }, // grave
+  { 0x00, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00 }, // circumflex
+  { 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00 }, // diaeresis
+  { 0x02, 0x01, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00 }, // tilde
+  { 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00 }, // ring
+  { 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 }, // dot
+  { 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00 }, // caron
+  { 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00 }, // breve
+  { 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00 }, // macron
+  { 0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00 }, // double acute
+  { 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00 }, // ogonek
+  { 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00 }, // cedilla
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01 }, // apostrophe
+};
+
+// glyphs the CP437 font has no base for
+const uint8 glyphExtra [] [8] = {
+  { 0x7F, 0x7F, 0x49, 0x49, 0x49, 0x79, 0x31, 0x00 }, // Б U+0411
+  { 0x60, 0x7E, 0x3F, 0x21, 0x3F, 0x7F, 0x60, 0x00 }, // Д U+0414
+  { 0x63, 0x77, 0x1C, 0x7F, 0x1C, 0x77, 0x63, 0x00 }, // Ж U+0416
+  { 0x22, 0x63, 0x49, 0x49, 0x7F, 0x36, 0x00, 0x00 }, // З U+0417
+  { 0x7F, 0x7F, 0x38, 0x1C, 0x0E, 0x7F, 0x7F, 0x00 }, // И U+0418
+  { 0x40, 0x7E, 0x7F, 0x01, 0x01, 0x7F, 0x7F, 0x00 }, // Л U+041B
+  { 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x7F, 0x7F, 0x00 }, // П U+041F
+  { 0x27, 0x6F, 0x48, 0x48, 0x7F, 0x3F, 0x00, 0x00 }, // У U+0423
+  { 0x3F, 0x3F, 0x20, 0x20, 0x3F, 0x3F, 0x60, 0x00 }, // Ц U+0426
+  { 0x07, 0x0F, 0x08, 0x08, 0x7F, 0x7F, 0x00, 0x00 }, // Ч U+0427
+  { 0x7F, 0x7F, 0x40, 0x7F, 0x40, 0x7F, 0x7F, 0x00 }, // Ш U+0428
+  { 0x3F, 0x3F, 0x20, 0x3F, 0x20, 0x3F, 0x3F, 0x60 }, // Щ U+0429
+  { 0x01, 0x7F, 0x7F, 0x48, 0x48, 0x78, 0x30, 0x00 }, // Ъ U+042A
+  { 0x7F, 0x7F, 0x48, 0x78, 0x30, 0x7F, 0x7F, 0x00 }, // Ы U+042B
+  { 0x7F, 0x7F, 0x48, 0x48, 0x78, 0x30, 0x00, 0x00 }, // Ь U+042C
+  { 0x22, 0x63, 0x49, 0x49, 0x7F, 0x3E, 0x00, 0x00 }, // Э U+042D
+  { 0x7F, 0x7F, 0x08, 0x3E, 0x41, 0x41, 0x3E, 0x00 }, // Ю U+042E
+  { 0x06, 0x4F, 0x69, 0x39, 0x19, 0x7F, 0x7F, 0x00 }, // Я U+042F
+  { 0x3E, 0x7F, 0x49, 0x49, 0x63, 0x22, 0x00, 0x00 }, // Є U+0404
+  { 0x70, 0x7C, 0x4E, 0x43, 0x4E, 0x7C, 0x70, 0x00 }, // Δ U+0394
+  { 0x70, 0x7C, 0x0E, 0x03, 0x0E, 0x7C, 0x70, 0x00 }, // Λ U+039B
+  { 0x41, 0x49, 0x49, 0x49, 0x49, 0x49, 0x41, 0x00 }, // Ξ U+039E
+  { 0x07, 0x0F, 0x48, 0x7F, 0x48, 0x0F, 0x07, 0x00 }, // Ψ U+03A8
+  { 0x3E, 0x7F, 0x41, 0x7F, 0x7F, 0x49, 0x49, 0x00 }, // Œ U+0152
+  { 0x14, 0x3E, 0x7F, 0x55, 0x55, 0x63, 0x22, 0x00 }, // € U+20AC
+  { 0x22, 0x36, 0x1C, 0x08, 0x1C, 0x36, 0x22, 0x00 }, // × U+00D7
+  { 0x00, 0x11, 0x15, 0x1F, 0x0A, 0x00, 0x00, 0x00 }, // ³ U+00B3
+  { 0x00, 0x12, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00 }, // ¹ U+00B9
+  { 0x40, 0x40, 0x00, 0x40, 0x40, 0x00, 0x40, 0x40 }, // … U+2026
+  { 0xE0, 0xF0, 0x18, 0x1C, 0xF4, 0xE4, 0x00, 0x00 }, // б U+0431
+  { 0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x28, 0x00, 0x00 }, // в U+0432
+  { 0x7C, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00 }, // г U+0433
+  { 0x60, 0x78, 0x3C, 0x24, 0x3C, 0x7C, 0x60, 0x00 }, // д U+0434
+  { 0x44, 0x6C, 0x38, 0x7C, 0x38, 0x6C, 0x44, 0x00 }, // ж U+0436
+  { 0x44, 0x44, 0x54, 0x54, 0x7C, 0x28, 0x00, 0x00 }, // з U+0437
+  { 0x7C, 0x7C, 0x30, 0x18, 0x7C, 0x7C, 0x00, 0x00 }, // и U+0438
+  { 0x7C, 0x7C, 0x10, 0x38, 0x6C, 0x44, 0x00, 0x00 }, // к U+043A
+  { 0x40, 0x78, 0x7C, 0x04, 0x7C, 0x7C, 0x00, 0x00 }, // л U+043B
+  { 0x7C, 0x7C, 0x18, 0x30, 0x18, 0x7C, 0x7C, 0x00 }, // м U+043C
+  { 0x7C, 0x7C, 0x10, 0x10, 0x7C, 0x7C, 0x00, 0x00 }, // н U+043D
+  { 0x7C, 0x7C, 0x04, 0x04, 0x7C, 0x7C, 0x00, 0x00 }, // п U+043F
+  { 0x04, 0x04, 0x7C, 0x7C, 0x04, 0x04, 0x00, 0x00 }, // т U+0442
+  { 0x7C, 0x7C, 0x40, 0x40, 0xFC, 0xFC, 0x00, 0x00 }, // ц U+0446
+  { 0x0C, 0x1C, 0x10, 0x10, 0x7C, 0x7C, 0x00, 0x00 }, // ч U+0447
+  { 0x7C, 0x7C, 0x40, 0x7C, 0x40, 0x7C, 0x7C, 0x00 }, // ш U+0448
+  { 0x7C, 0x7C, 0x40, 0x7C, 0x40, 0x7C, 0x7C, 0xC0 }, // щ U+0449
+  { 0x04, 0x7C, 0x7C, 0x50, 0x70, 0x20, 0x00, 0x00 }, // ъ U+044A
+  { 0x7C, 0x7C, 0x50, 0x70, 0x20, 0x7C, 0x7C, 0x00 }, // ы U+044B
+  { 0x7C, 0x7C, 0x50, 0x70, 0x20, 0x00, 0x00, 0x00 }, // ь U+044C
+  { 0x00, 0x44, 0x54, 0x54, 0x7C, 0x38, 0x00, 0x00 }, // э U+044D
+  { 0x7C, 0x7C, 0x10, 0x38, 0x44, 0x44, 0x38, 0x00 }, // ю U+044E
+  { 0x48, 0x5C, 0x34, 0x34, 0x7C, 0x7C, 0x00, 0x00 }, // я U+044F
+  { 0x38, 0x7C, 0x54, 0x54, 0x44, 0x00, 0x00, 0x00 }, // є U+0454
+  { 0x78, 0x7C, 0x64, 0x54, 0x7C, 0x38, 0x04, 0x00 }, // ø U+00F8
+  { 0x38, 0x7C, 0x44, 0x38, 0x7C, 0x54, 0x58, 0x08 }, // œ U+0153
+  { 0x00, 0x44, 0x7C, 0x7C, 0x40, 0x00, 0x00, 0x00 }, // ı U+0131
+  { 0x60, 0xE0, 0x80, 0x80, 0xFC, 0x7C, 0x00, 0x00 }, // ȷ U+0237
+  { 0x41, 0x7F, 0x7F, 0x45, 0x40, 0x60, 0x70, 0x00 }, // Ł U+0141
+  { 0x00, 0x41, 0x7F, 0x7F, 0x44, 0x00, 0x00, 0x00 }, // ł U+0142
+  { 0x49, 0x7F, 0x7F, 0x49, 0x63, 0x3E, 0x1C, 0x00 }, // Đ U+0110
+  { 0x30, 0x78, 0x48, 0x49, 0x3F, 0x7F, 0x41, 0x01 }, // đ U+0111
+  { 0x5C, 0x3E, 0x73, 0x49, 0x67, 0x3E, 0x1D, 0x00 }, // Ø U+00D8
+};
+
+// code points with a glyph, in order: a CP437 glyph or an extra one, and the mark drawn on it
+const GLYPH_ENTRY_T glyphStore [] = {
+  { 0x00A0, 0x20, 0 }, // NO-BREAK SPACE
+  { 0x00A1, 0xAD, 0 }, // ¡
+  { 0x00A2, 0x9B, 0 }, // ¢
+  { 0x00A3, 0x9C, 0 }, // £
+  { 0x00A5, 0x9D, 0 }, // ¥
+  { 0x00A7, 0x15, 0 }, // §
+  { 0x00AA, 0xA6, 0 }, // ª
+  { 0x00AB, 0xAE, 0 }, // «
+  { 0x00AC, 0xAA, 0 }, // ¬
+  { 0x00AD, 0x2D, 0 }, // SOFT HYPHEN
+  { 0x00B0, 0xF8, 0 }, // °
+  { 0x00B1, 0xF1, 0 }, // ±
+  { 0x00B2, 0xFD, 0 }, // ²
+  { 0x00B3, 0x1A, GLYPH_EXTRA }, // ³
+  { 0x00B4, 0x27, 0 }, // ´
+  { 0x00B5, 0xE6, 0 }, // µ
+  { 0x00B6, 0x14, 0 }, // ¶
+  { 0x00B7, 0xFA, 0 }, // ·
+  { 0x00B9, 0x1B, GLYPH_EXTRA }, // ¹
+  { 0x00BA, 0xA7, 0 }, // º
+  { 0x00BB, 0xAF, 0 }, // »
+  { 0x00BC, 0xAC, 0 }, // ¼
+  { 0x00BD, 0xAB, 0 }, // ½
+  { 0x00BF, 0xA8, 0 }, // ¿
+  { 0x00C0, 0x41, GLYPH_MARK_GRAVE | GLYPH_SQUASH }, // À
+  { 0x00C1, 0x41, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Á
+  { 0x00C2, 0x41, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Â
+  { 0x00C3, 0x41, GLYPH_MARK_TILDE | GLYPH_SQUASH }, // Ã
+  { 0x00C4, 0x8E, 0 }, // Ä
+  { 0x00C5, 0x8F, 0 }, // Å
+  { 0x00C6, 0x92, 0 }, // Æ
+  { 0x00C7, 0x43, GLYPH_MARK_CEDILLA }, // Ç
+  { 0x00C8, 0x45, GLYPH_MARK_GRAVE | GLYPH_SQUASH }, // È
+  { 0x00C9, 0x90, 0 }, // É
+  { 0x00CA, 0x45, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ê
+  { 0x00CB, 0x45, GLYPH_MARK_DIAERESIS | GLYPH_SQUASH }, // Ë
+  { 0x00CC, 0x49, GLYPH_MARK_GRAVE | GLYPH_SQUASH }, // Ì
+  { 0x00CD, 0x49, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Í
+  { 0x00CE, 0x49, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Î
+  { 0x00CF, 0x49, GLYPH_MARK_DIAERESIS | GLYPH_SQUASH }, // Ï
+  { 0x00D1, 0xA5, 0 }, // Ñ
+  { 0x00D2, 0x4F, GLYPH_MARK_GRAVE | GLYPH_SQUASH }, // Ò
+  { 0x00D3, 0x4F, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ó
+  { 0x00D4, 0x4F, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ô
+  { 0x00D5, 0x4F, GLYPH_MARK_TILDE | GLYPH_SQUASH }, // Õ
+  { 0x00D6, 0x99, 0 }, // Ö
+  { 0x00D7, 0x19, GLYPH_EXTRA }, // ×
+  { 0x00D8, 0x3D, GLYPH_EXTRA }, // Ø
+  { 0x00D9, 0x55, GLYPH_MARK_GRAVE | GLYPH_SQUASH }, // Ù
+  { 0x00DA, 0x55, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ú
+  { 0x00DB, 0x55, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Û
+  { 0x00DC, 0x9A, 0 }, // Ü
+  { 0x00DD, 0x59, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ý
+  { 0x00DF, 0xE1, 0 }, // ß
+  { 0x00E0, 0x85, 0 }, // à
+  { 0x00E1, 0xA0, 0 }, // á
+  { 0x00E2, 0x83, 0 }, // â
+  { 0x00E3, 0x61, GLYPH_MARK_TILDE }, // ã
+  { 0x00E4, 0x84, 0 }, // ä
+  { 0x00E5, 0x86, 0 }, // å
+  { 0x00E6, 0x91, 0 }, // æ
+  { 0x00E7, 0x87, 0 }, // ç
+  { 0x00E8, 0x8A, 0 }, // è
+  { 0x00E9, 0x82, 0 }, // é
+  { 0x00EA, 0x88, 0 }, // ê
+  { 0x00EB, 0x89, 0 }, // ë
+  { 0x00EC, 0x8D, 0 }, // ì
+  { 0x00ED, 0xA1, 0 }, // í
+  { 0x00EE, 0x8C, 0 }, // î
+  { 0x00EF, 0x8B, 0 }, // ï
+  { 0x00F1, 0xA4, 0 }, // ñ
+  { 0x00F2, 0x95, 0 }, // ò
+  { 0x00F3, 0xA2, 0 }, // ó
+  { 0x00F4, 0x93, 0 }, // ô
+  { 0x00F5, 0x6F, GLYPH_MARK_TILDE }, // õ
+  { 0x00F6, 0x94, 0 }, // ö
+  { 0x00F7, 0xF6, 0 }, // ÷
+  { 0x00F8, 0x35, GLYPH_EXTRA }, // ø
+  { 0x00F9, 0x97, 0 }, // ù
+  { 0x00FA, 0xA3, 0 }, // ú
+  { 0x00FB, 0x96, 0 }, // û
+  { 0x00FC, 0x81, 0 }, // ü
+  { 0x00FD, 0x79, GLYPH_MARK_ACUTE }, // ý
+  { 0x00FF, 0x98, 0 }, // ÿ
+  { 0x0100, 0x41, GLYPH_MARK_MACRON | GLYPH_SQUASH }, // Ā
+  { 0x0101, 0x61, GLYPH_MARK_MACRON }, // ā
+  { 0x0102, 0x41, GLYPH_MARK_BREVE | GLYPH_SQUASH }, // Ă
+  { 0x0103, 0x61, GLYPH_MARK_BREVE }, // ă
+  { 0x0104, 0x41, GLYPH_MARK_OGONEK }, // Ą
+  { 0x0105, 0x61, GLYPH_MARK_OGONEK }, // ą
+  { 0x0106, 0x43, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ć
+  { 0x0107, 0x63, GLYPH_MARK_ACUTE }, // ć
+  { 0x0108, 0x43, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ĉ
+  { 0x0109, 0x63, GLYPH_MARK_CIRCUMFLEX }, // ĉ
+  { 0x010A, 0x43, GLYPH_MARK_DOT | GLYPH_SQUASH }, // Ċ
+  { 0x010B, 0x63, GLYPH_MARK_DOT }, // ċ
+  { 0x010C, 0x43, GLYPH_MARK_CARON | GLYPH_SQUASH }, // Č
+  { 0x010D, 0x63, GLYPH_MARK_CARON }, // č
+  { 0x010E, 0x44, GLYPH_MARK_CARON | GLYPH_SQUASH }, // Ď
+  { 0x010F, 0x64, GLYPH_MARK_APOSTROPHE }, // ď
+  { 0x0110, 0x3B, GLYPH_EXTRA }, // Đ
+  { 0x0111, 0x3C, GLYPH_EXTRA }, // đ
+  { 0x0112, 0x45, GLYPH_MARK_MACRON | GLYPH_SQUASH }, // Ē
+  { 0x0113, 0x65, GLYPH_MARK_MACRON }, // ē
+  { 0x0114, 0x45, GLYPH_MARK_BREVE | GLYPH_SQUASH }, // Ĕ
+  { 0x0115, 0x65, GLYPH_MARK_BREVE }, // ĕ
+  { 0x0116, 0x45, GLYPH_MARK_DOT | GLYPH_SQUASH }, // Ė
+  { 0x0117, 0x65, GLYPH_MARK_DOT }, // ė
+  { 0x0118, 0x45, GLYPH_MARK_OGONEK }, // Ę
+  { 0x0119, 0x65, GLYPH_MARK_OGONEK }, // ę
+  { 0x011A, 0x45, GLYPH_MARK_CARON | GLYPH_SQUASH }, // Ě
+  { 0x011B, 0x65, GLYPH_MARK_CARON }, // ě
+  { 0x011C, 0x47, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ĝ
+  { 0x011D, 0x67, GLYPH_MARK_CIRCUMFLEX }, // ĝ
+  { 0x011E, 0x47, GLYPH_MARK_BREVE | GLYPH_SQUASH }, // Ğ
+  { 0x011F, 0x67, GLYPH_MARK_BREVE }, // ğ
+  { 0x0120, 0x47, GLYPH_MARK_DOT | GLYPH_SQUASH }, // Ġ
+  { 0x0121, 0x67, GLYPH_MARK_DOT }, // ġ
+  { 0x0122, 0x47, GLYPH_MARK_CEDILLA }, // Ģ
+  { 0x0123, 0x67, GLYPH_MARK_CEDILLA }, // ģ
+  { 0x0124, 0x48, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ĥ
+  { 0x0125, 0x68, GLYPH_MARK_CIRCUMFLEX }, // ĥ
+  { 0x0128, 0x49, GLYPH_MARK_TILDE | GLYPH_SQUASH }, // Ĩ
+  { 0x0129, 0x37, GLYPH_MARK_TILDE | GLYPH_EXTRA }, // ĩ
+  { 0x012A, 0x49, GLYPH_MARK_MACRON | GLYPH_SQUASH }, // Ī
+  { 0x012B, 0x37, GLYPH_MARK_MACRON | GLYPH_EXTRA }, // ī
+  { 0x012C, 0x49, GLYPH_MARK_BREVE | GLYPH_SQUASH }, // Ĭ
+  { 0x012D, 0x37, GLYPH_MARK_BREVE | GLYPH_EXTRA }, // ĭ
+  { 0x012E, 0x49, GLYPH_MARK_OGONEK }, // Į
+  { 0x012F, 0x69, GLYPH_MARK_OGONEK }, // į
+  { 0x0130, 0x49, GLYPH_MARK_DOT | GLYPH_SQUASH }, // İ
+  { 0x0131, 0x37, GLYPH_EXTRA }, // ı
+  { 0x0134, 0x4A, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ĵ
+  { 0x0135, 0x38, GLYPH_MARK_CIRCUMFLEX | GLYPH_EXTRA }, // ĵ
+  { 0x0136, 0x4B, GLYPH_MARK_CEDILLA }, // Ķ
+  { 0x0137, 0x6B, GLYPH_MARK_CEDILLA }, // ķ
+  { 0x0139, 0x4C, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ĺ
+  { 0x013A, 0x6C, GLYPH_MARK_ACUTE }, // ĺ
+  { 0x013B, 0x4C, GLYPH_MARK_CEDILLA }, // Ļ
+  { 0x013C, 0x6C, GLYPH_MARK_CEDILLA }, // ļ
+  { 0x013D, 0x4C, GLYPH_MARK_APOSTROPHE }, // Ľ
+  { 0x013E, 0x6C, GLYPH_MARK_APOSTROPHE }, // ľ
+  { 0x0141, 0x39, GLYPH_EXTRA }, // Ł
+  { 0x0142, 0x3A, GLYPH_EXTRA }, // ł
+  { 0x0143, 0x4E, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ń
+  { 0x0144, 0x6E, GLYPH_MARK_ACUTE }, // ń
+  { 0x0145, 0x4E, GLYPH_MARK_CEDILLA }, // Ņ
+  { 0x0146, 0x6E, GLYPH_MARK_CEDILLA }, // ņ
+  { 0x0147, 0x4E, GLYPH_MARK_CARON | GLYPH_SQUASH }, // Ň
+  { 0x0148, 0x6E, GLYPH_MARK_CARON }, // ň
+  { 0x014C, 0x4F, GLYPH_MARK_MACRON | GLYPH_SQUASH }, // Ō
+  { 0x014D, 0x6F, GLYPH_MARK_MACRON }, // ō
+  { 0x014E, 0x4F, GLYPH_MARK_BREVE | GLYPH_SQUASH }, // Ŏ
+  { 0x014F, 0x6F, GLYPH_MARK_BREVE }, // ŏ
+  { 0x0150, 0x4F, GLYPH_MARK_DOUBLE_ACUTE | GLYPH_SQUASH }, // Ő
+  { 0x0151, 0x6F, GLYPH_MARK_DOUBLE_ACUTE }, // ő
+  { 0x0152, 0x17, GLYPH_EXTRA }, // Œ
+  { 0x0153, 0x36, GLYPH_EXTRA }, // œ
+  { 0x0154, 0x52, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ŕ
+  { 0x0155, 0x72, GLYPH_MARK_ACUTE }, // ŕ
+  { 0x0156, 0x52, GLYPH_MARK_CEDILLA }, // Ŗ
+  { 0x0157, 0x72, GLYPH_MARK_CEDILLA }, // ŗ
+  { 0x0158, 0x52, GLYPH_MARK_CARON | GLYPH_SQUASH }, // Ř
+  { 0x0159, 0x72, GLYPH_MARK_CARON }, // ř
+  { 0x015A, 0x53, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ś
+  { 0x015B, 0x73, GLYPH_MARK_ACUTE }, // ś
+  { 0x015C, 0x53, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ŝ
+  { 0x015D, 0x73, GLYPH_MARK_CIRCUMFLEX }, // ŝ
+  { 0x015E, 0x53, GLYPH_MARK_CEDILLA }, // Ş
+  { 0x015F, 0x73, GLYPH_MARK_CEDILLA }, // ş
+  { 0x0160, 0x53, GLYPH_MARK_CARON | GLYPH_SQUASH }, // Š
+  { 0x0161, 0x73, GLYPH_MARK_CARON }, // š
+  { 0x0162, 0x54, GLYPH_MARK_CEDILLA }, // Ţ
+  { 0x0163, 0x74, GLYPH_MARK_CEDILLA }, // ţ
+  { 0x0164, 0x54, GLYPH_MARK_APOSTROPHE }, // Ť
+  { 0x0165, 0x74, GLYPH_MARK_APOSTROPHE }, // ť
+  { 0x0168, 0x55, GLYPH_MARK_TILDE | GLYPH_SQUASH }, // Ũ
+  { 0x0169, 0x75, GLYPH_MARK_TILDE }, // ũ
+  { 0x016A, 0x55, GLYPH_MARK_MACRON | GLYPH_SQUASH }, // Ū
+  { 0x016B, 0x75, GLYPH_MARK_MACRON }, // ū
+  { 0x016C, 0x55, GLYPH_MARK_BREVE | GLYPH_SQUASH }, // Ŭ
+  { 0x016D, 0x75, GLYPH_MARK_BREVE }, // ŭ
+  { 0x016E, 0x55, GLYPH_MARK_RING | GLYPH_SQUASH }, // Ů
+  { 0x016F, 0x75, GLYPH_MARK_RING }, // ů
+  { 0x0170, 0x55, GLYPH_MARK_DOUBLE_ACUTE | GLYPH_SQUASH }, // Ű
+  { 0x0171, 0x75, GLYPH_MARK_DOUBLE_ACUTE }, // ű
+  { 0x0172, 0x55, GLYPH_MARK_OGONEK }, // Ų
+  { 0x0173, 0x75, GLYPH_MARK_OGONEK }, // ų
+  { 0x0174, 0x57, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ŵ
+  { 0x0175, 0x77, GLYPH_MARK_CIRCUMFLEX }, // ŵ
+  { 0x0176, 0x59, GLYPH_MARK_CIRCUMFLEX | GLYPH_SQUASH }, // Ŷ
+  { 0x0177, 0x79, GLYPH_MARK_CIRCUMFLEX }, // ŷ
+  { 0x0178, 0x59, GLYPH_MARK_DIAERESIS | GLYPH_SQUASH }, // Ÿ
+  { 0x0179, 0x5A, GLYPH_MARK_ACUTE | GLYPH_SQUASH }, // Ź
+  { 0x017A, 0x7A, GLYPH_MARK_ACUTE }, // ź
+  { 0x017B, 0x5A, GLYPH_MARK_DOT | GLYPH_SQUASH }, // Ż
+  { 0x017C, 0x7A, GLYPH_MARK_DOT }, // ż
+  { 0x017D, 0x5A, GLYPH_MARK_CARON | GLYPH_SQUASH }, // Ž
+  { 0x017E, 0x7A, GLYPH_MARK_CARON }, // ž
+  { 0x0192, 0x9F, 0 }, // ƒ
+  { 0x0218, 0x53, GLYPH_MARK_CEDILLA }, // Ș
+  { 0x0219, 0x73, GLYPH_MARK_CEDILLA }, // ș
+  { 0x021A, 0x54, GLYPH_MARK_CEDILLA }, // Ț
+  { 0x021B, 0x74, GLYPH_MARK_CEDILLA }, // ț
+  { 0x0237, 0x38, GLYPH_EXTRA }, // ȷ
+  { 0x0391, 0x41, 0 }, // Α
+  { 0x0392, 0x42, 0 }, // Β
+  { 0x0393, 0xE2, 0 }, // Γ
+  { 0x0394, 0x13, GLYPH_EXTRA }, // Δ
+  { 0x0395, 0x45, 0 }, // Ε
+  { 0x0396, 0x5A, 0 }, // Ζ
+  { 0x0397, 0x48, 0 }, // Η
+  { 0x0398, 0xE9, 0 }, // Θ
+  { 0x0399, 0x49, 0 }, // Ι
+  { 0x039A, 0x4B, 0 }, // Κ
+  { 0x039B, 0x14, GLYPH_EXTRA }, // Λ
+  { 0x039C, 0x4D, 0 }, // Μ
+  { 0x039D, 0x4E, 0 }, // Ν
+  { 0x039E, 0x15, GLYPH_EXTRA }, // Ξ
+  { 0x039F, 0x4F, 0 }, // Ο
+  { 0x03A0, 0x06, GLYPH_EXTRA }, // Π
+  { 0x03A1, 0x50, 0 }, // Ρ
+  { 0x03A3, 0xE4, 0 }, // Σ
+  { 0x03A4, 0x54, 0 }, // Τ
+  { 0x03A5, 0x59, 0 }, // Υ
+  { 0x03A6, 0xE8, 0 }, // Φ
+  { 0x03A7, 0x58, 0 }, // Χ
+  { 0x03A8, 0x16, GLYPH_EXTRA }, // Ψ
+  { 0x03A9, 0xEA, 0 }, // Ω
+  { 0x03B1, 0xE0, 0 }, // α
+  { 0x03B2, 0xE1, 0 }, // β
+  { 0x03B4, 0xEB, 0 }, // δ
+  { 0x03B5, 0xEE, 0 }, // ε
+  { 0x03BA, 0x6B, 0 }, // κ
+  { 0x03BC, 0xE6, 0 }, // μ
+  { 0x03BD, 0x76, 0 }, // ν
+  { 0x03BF, 0x6F, 0 }, // ο
+  { 0x03C0, 0xE3, 0 }, // π
+  { 0x03C1, 0x70, 0 }, // ρ
+  { 0x03C3, 0xE5, 0 }, // σ
+  { 0x03C4, 0xE7, 0 }, // τ
+  { 0x03C6, 0xED, 0 }, // φ
+  { 0x03C7, 0x78, 0 }, // χ
+  { 0x0401, 0x45, GLYPH_MARK_DIAERESIS | GLYPH_SQUASH }, // Ё
+  { 0x0404, 0x12, GLYPH_EXTRA }, // Є
+  { 0x0405, 0x53, 0 }, // Ѕ
+  { 0x0406, 0x49, 0 }, // І
+  { 0x0407, 0x49, GLYPH_MARK_DIAERESIS | GLYPH_SQUASH }, // Ї
+  { 0x0408, 0x4A, 0 }, // Ј
+  { 0x0410, 0x41, 0 }, // А
+  { 0x0411, 0x00, GLYPH_EXTRA }, // Б
+  { 0x0412, 0x42, 0 }, // В
+  { 0x0413, 0xE2, 0 }, // Г
+  { 0x0414, 0x01, GLYPH_EXTRA }, // Д
+  { 0x0415, 0x45, 0 }, // Е
+  { 0x0416, 0x02, GLYPH_EXTRA }, // Ж
+  { 0x0417, 0x03, GLYPH_EXTRA }, // З
+  { 0x0418, 0x04, GLYPH_EXTRA }, // И
+  { 0x0419, 0x04, GLYPH_MARK_BREVE | GLYPH_EXTRA | GLYPH_SQUASH }, // Й
+  { 0x041A, 0x4B, 0 }, // К
+  { 0x041B, 0x05, GLYPH_EXTRA }, // Л
+  { 0x041C, 0x4D, 0 }, // М
+  { 0x041D, 0x48, 0 }, // Н
+  { 0x041E, 0x4F, 0 }, // О
+  { 0x041F, 0x06, GLYPH_EXTRA }, // П
+  { 0x0420, 0x50, 0 }, // Р
+  { 0x0421, 0x43, 0 }, // С
+  { 0x0422, 0x54, 0 }, // Т
+  { 0x0423, 0x07, GLYPH_EXTRA }, // У
+  { 0x0424, 0xE8, 0 }, // Ф
+  { 0x0425, 0x58, 0 }, // Х
+  { 0x0426, 0x08, GLYPH_EXTRA }, // Ц
+  { 0x0427, 0x09, GLYPH_EXTRA }, // Ч
+  { 0x0428, 0x0A, GLYPH_EXTRA }, // Ш
+  { 0x0429, 0x0B, GLYPH_EXTRA }, // Щ
+  { 0x042A, 0x0C, GLYPH_EXTRA }, // Ъ
+  { 0x042B, 0x0D, GLYPH_EXTRA }, // Ы
+  { 0x042C, 0x0E, GLYPH_EXTRA }, // Ь
+  { 0x042D, 0x0F, GLYPH_EXTRA }, // Э
+  { 0x042E, 0x10, GLYPH_EXTRA }, // Ю
+  { 0x042F, 0x11, GLYPH_EXTRA }, // Я
+  { 0x0430, 0x61, 0 }, // а
+  { 0x0431, 0x1D, GLYPH_EXTRA }, // б
+  { 0x0432, 0x1E, GLYPH_EXTRA }, // в
+  { 0x0433, 0x1F, GLYPH_EXTRA }, // г
+  { 0x0434, 0x20, GLYPH_EXTRA }, // д
+  { 0x0435, 0x65, 0 }, // е
+  { 0x0436, 0x21, GLYPH_EXTRA }, // ж
+  { 0x0437, 0x22, GLYPH_EXTRA }, // з
+  { 0x0438, 0x23, GLYPH_EXTRA }, // и
+  { 0x0439, 0x23, GLYPH_MARK_BREVE | GLYPH_EXTRA }, // й
+  { 0x043A, 0x24, GLYPH_EXTRA }, // к
+  { 0x043B, 0x25, GLYPH_EXTRA }, // л
+  { 0x043C, 0x26, GLYPH_EXTRA }, // м
+  { 0x043D, 0x27, GLYPH_EXTRA }, // н
+  { 0x043E, 0x6F, 0 }, // о
+  { 0x043F, 0x28, GLYPH_EXTRA }, // п
+  { 0x0440, 0x70, 0 }, // р
+  { 0x0441, 0x63, 0 }, // с
+  { 0x0442, 0x29, GLYPH_EXTRA }, // т
+  { 0x0443, 0x79, 0 }, // у
+  { 0x0444, 0xED, 0 }, // ф
+  { 0x0445, 0x78, 0 }, // х
+  { 0x0446, 0x2A, GLYPH_EXTRA }, // ц
+  { 0x0447, 0x2B, GLYPH_EXTRA }, // ч
+  { 0x0448, 0x2C, GLYPH_EXTRA }, // ш
+  { 0x0449, 0x2D, GLYPH_EXTRA }, // щ
+  { 0x044A, 0x2E, GLYPH_EXTRA }, // ъ
+  { 0x044B, 0x2F, GLYPH_EXTRA }, // ы
+  { 0x044C, 0x30, GLYPH_EXTRA }, // ь
+  { 0x044D, 0x31, GLYPH_EXTRA }, // э
+  { 0x044E, 0x32, GLYPH_EXTRA }, // ю
+  { 0x044F, 0x33, GLYPH_EXTRA }, // я
+  { 0x0451, 0x89, 0 }, // ё
+  { 0x0454, 0x34, GLYPH_EXTRA }, // є
+  { 0x0455, 0x73, 0 }, // ѕ
+  { 0x0456, 0x69, 0 }, // і
+  { 0x0457, 0x8B, 0 }, // ї
+  { 0x0458, 0x6A, 0 }, // ј
+  { 0x2009, 0x20, 0 }, // THIN SPACE
+  { 0x2010, 0x2D, 0 }, // ‐
+  { 0x2011, 0x2D, 0 }, // ‑
+  { 0x2013, 0x2D, 0 }, // –
+  { 0x2014, 0xC4, 0 }, // —
+  { 0x2015, 0xC4, 0 }, // ―
+  { 0x2018, 0x27, 0 }, // ‘
+  { 0x2019, 0x27, 0 }, // ’
+  { 0x201A, 0x2C, 0 }, // ‚
+  { 0x201B, 0x27, 0 }, // ‛
+  { 0x201C, 0x22, 0 }, // “
+  { 0x201D, 0x22, 0 }, // ”
+  { 0x201E, 0x22, 0 }, // „
+  { 0x2022, 0x07, 0 }, // •
+  { 0x2026, 0x1C, GLYPH_EXTRA }, // …
+  { 0x202F, 0x20, 0 }, // NARROW NO-BREAK SPACE
+  { 0x2032, 0x27, 0 }, // ′
+  { 0x2033, 0x22, 0 }, // ″
+  { 0x2039, 0x3C, 0 }, // ‹
+  { 0x203A, 0x3E, 0 }, // ›
+  { 0x203C, 0x13, 0 }, // ‼
+  { 0x2044, 0x2F, 0 }, // ⁄
+  { 0x207F, 0xFC, 0 }, // ⁿ
+  { 0x20A7, 0x9E, 0 }, // ₧
+  { 0x20AC, 0x18, GLYPH_EXTRA }, // €
+  { 0x2190, 0x1B, 0 }, // ←
+  { 0x2191, 0x18, 0 }, // ↑
+  { 0x2192, 0x1A, 0 }, // →
+  { 0x2193, 0x19, 0 }, // ↓
+  { 0x2194, 0x1D, 0 }, // ↔
+  { 0x2195, 0x12, 0 }, // ↕
+  { 0x21A8, 0x17, 0 }, // ↨
+  { 0x2212, 0x2D, 0 }, // −
+  { 0x2219, 0xF9, 0 }, // ∙
+  { 0x221A, 0xFB, 0 }, // √
+  { 0x221E, 0xEC, 0 }, // ∞
+  { 0x221F, 0x1C, 0 }, // ∟
+  { 0x2229, 0xEF, 0 }, // ∩
+  { 0x2248, 0xF7, 0 }, // ≈
+  { 0x2261, 0xF0, 0 }, // ≡
+  { 0x2264, 0xF3, 0 }, // ≤
+  { 0x2265, 0xF2, 0 }, // ≥
+  { 0x2302, 0x7F, 0 }, // ⌂
+  { 0x2310, 0xA9, 0 }, // ⌐
+  { 0x2320, 0xF4, 0 }, // ⌠
+  { 0x2321, 0xF5, 0 }, // ⌡
+  { 0x2500, 0xC4, 0 }, // ─
+  { 0x2502, 0xB3, 0 }, // │
+  { 0x250C, 0xDA, 0 }, // ┌
+  { 0x2510, 0xBF, 0 }, // ┐
+  { 0x2514, 0xC0, 0 }, // └
+  { 0x2518, 0xD9, 0 }, // ┘
+  { 0x251C, 0xC3, 0 }, // ├
+  { 0x2524, 0xB4, 0 }, // ┤
+  { 0x252C, 0xC2, 0 }, // ┬
+  { 0x2534, 0xC1, 0 }, // ┴
+  { 0x253C, 0xC5, 0 }, // ┼
+  { 0x2550, 0xCD, 0 }, // ═
+  { 0x2551, 0xBA, 0 }, // ║
+  { 0x2552, 0xD5, 0 }, // ╒
+  { 0x2553, 0xD6, 0 }, // ╓
+  { 0x2554, 0xC9, 0 }, // ╔
+  { 0x2555, 0xB8, 0 }, // ╕
+  { 0x2556, 0xB7, 0 }, // ╖
+  { 0x2557, 0xBB, 0 }, // ╗
+  { 0x2558, 0xD4, 0 }, // ╘
+  { 0x2559, 0xD3, 0 }, // ╙
+  { 0x255A, 0xC8, 0 }, // ╚
+  { 0x255B, 0xBE, 0 }, // ╛
+  { 0x255C, 0xBD, 0 }, // ╜
+  { 0x255D, 0xBC, 0 }, // ╝
+  { 0x255E, 0xC6, 0 }, // ╞
+  { 0x255F, 0xC7, 0 }, // ╟
+  { 0x2560, 0xCC, 0 }, // ╠
+  { 0x2561, 0xB5, 0 }, // ╡
+  { 0x2562, 0xB6, 0 }, // ╢
+  { 0x2563, 0xB9, 0 }, // ╣
+  { 0x2564, 0xD1, 0 }, // ╤
+  { 0x2565, 0xD2, 0 }, // ╥
+  { 0x2566, 0xCB, 0 }, // ╦
+  { 0x2567, 0xCF, 0 }, // ╧
+  { 0x2568, 0xD0, 0 }, // ╨
+  { 0x2569, 0xCA, 0 }, // ╩
+  { 0x256A, 0xD8, 0 }, // ╪
+  { 0x256B, 0xD7, 0 }, // ╫
+  { 0x256C, 0xCE, 0 }, // ╬
+  { 0x2580, 0xDF, 0 }, // ▀
+  { 0x2584, 0xDC, 0 }, // ▄
+  { 0x2588, 0xDB, 0 }, // █
+  { 0x258C, 0xDD, 0 }, // ▌
+  { 0x2590, 0xDE, 0 }, // ▐
+  { 0x2591, 0xB0, 0 }, // ░
+  { 0x2592, 0xB1, 0 }, // ▒
+  { 0x2593, 0xB2, 0 }, // ▓
+  { 0x25A0, 0xFE, 0 }, // ■
+  { 0x25AC, 0x16, 0 }, // ▬
+  { 0x25B2, 0x1E, 0 }, // ▲
+  { 0x25BA, 0x10, 0 }, // ►
+  { 0x25BC, 0x1F, 0 }, // ▼
+  { 0x25C4, 0x11, 0 }, // ◄
+  { 0x25CB, 0x09, 0 }, // ○
+  { 0x25D8, 0x08, 0 }, // ◘
+  { 0x25D9, 0x0A, 0 }, // ◙
+  { 0x263A, 0x01, 0 }, // ☺
+  { 0x263B, 0x02, 0 }, // ☻
+  { 0x263C, 0x0F, 0 }, // ☼
+  { 0x2640, 0x0C, 0 }, // ♀
+  { 0x2642, 0x0B, 0 }, // ♂
+  { 0x2660, 0x06, 0 }, // ♠
+  { 0x2663, 0x05, 0 }, // ♣
+  { 0x2665, 0x03, 0 }, // ♥
+  { 0x2666, 0x04, 0 }, // ♦
+  { 0x266A, 0x0D, 0 }, // ♪
+  { 0x266B, 0x0E, 0 }, // ♫
+};
+const uint16 glyphStoreCount = sizeof(glyphStore) / sizeof(glyphStore[0]);
+
+/* [] END OF FILE */
@@ -10,15 +10,28 @@
  * ========================================
 */
 #include <main.h>
+#include <LiveStream.h>
+#include <TextSource.h>
+#include <Command.h>
+#include <Ticker.h>
+#include <Sprite.h>
+#include <Clock.h>
+#include <Schedule.h>
+
+static const TEXT_DESC_T bootMessage = { "PSoC Rocks!!", 12, TEXT_SOURCE_FLASH };
 
 int main()
 {
     /* Place your initialization/startup code here (e.g. MyInst_Start()) */
     StandardDisplayInit();
+    SpriteInit();
+    ClockInit();
+    ScheduleInit();
+    UART_Start();
     
     CyGlobalIntEnable;
     
-    DisplayMessage("PSoC Rocks!!", 12);
+    DisplayText(&bootMessage);
     
     CyBle_Start(StackEventHandler);
     
@@ -26,6 +39,12 @@ int main()
     {
         /* CyBle_ProcessEvents() allows BLE stack to process pending events */
         CyBle_ProcessEvents();
+        
+        LiveStreamService();
+        ScheduleService();
+        CommandService();
+        TickerService();
+        ClockService();
     }
 }
 
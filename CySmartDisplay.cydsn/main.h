@@ -20,10 +20,30 @@
 #define HIGH            1
 #define LOW             0
 #define SPI_DELAY       150
-#define MODULE_COUNT    2
+#ifndef PANEL_COLUMNS   // a host build may give another geometry
+#define PANEL_COLUMNS   2           // modules across the panel
+#define PANEL_ROWS      1           // modules down the panel
+#define PANEL_LAYOUT    { 0, 1 }    // chain position of each module, row by row from the top left
+#define PANEL_ORIENT    { MODULE_ROT_0, MODULE_ROT_0 }  // how each module is mounted (Orient.h), same order
+#endif
+#define MODULE_COUNT    (PANEL_COLUMNS * PANEL_ROWS)
+#define MESSAGE_SIZE    180     // length of the MESSAGE Control attribute
+#define GATT_ERR_BUSY   ((CYBLE_GATT_ERR_CODE_T)0x80u)  // application error: busy, send the write again
+
+#define DISPLAY_MODE_TEXT   0   // scroll the active text through the renderer
+#define DISPLAY_MODE_LIVE   1   // show columns streamed over FRAMEBUFFER Control
+#define DISPLAY_MODE_TICKER 2   // scroll text appended to the ticker ring
+#define DISPLAY_MODE_GRAY   3   // hold a grayscale image from GRAY Command
+#define DISPLAY_MODE_ANIM   4   // play the frames uploaded over ANIMATION Control
+#define DISPLAY_MODE_DRAW   5   // hold what DRAW Control drew
+#define DISPLAY_MODE_PAGE   6   // show the message a page at a time, paging up
 
 uint8   deviceConnected;   // TRUE when Device is connected to Server
-extern  char buffer[180];
+extern  volatile uint8 displayMode;
+
+extern const uint8 MAX7219_REG_NOOP;
+extern const uint8 MAX7219_REG_DIGIT0;
+extern const uint8 MAX7219_REG_INTENSITY;
     
 /*******************************************************************************
 * RGB LED Defines
@@ -37,10 +57,15 @@ extern  char buffer[180];
 * Function declaration
 *******************************************************************************/
 void StackEventHandler(uint32 event, void *eventParam);
+void SendPacketNoCS(const uint8 reg, uint8 data);
 void StandardDisplayInit(void);
 void DisplayMessage(char *message, uint8 length);
 void DisplayBrightness(uint8 level);
 void DispaySpeed(uint8 speed);
+void DisplayBaseSpeed(void);
+void DisplayPower(uint8 on);
+uint16 DisplayStepRate(uint8 divider);
+uint16 DisplayTickRate(void);
 
 #endif
 /* [] END OF FILE */
@@ -0,0 +1,258 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Frame-sequence playback on the 4 x 8 wall. Three animations are packed
+* with keyframes only, XOR rows and XOR runs, uploaded a flash row at a time
+* through AnimWrite, and played back: every decoded frame must match the
+* frame it was packed from. Reports the stream size, the rows a frame
+* changes, the host time to decode a frame, and the digit packets a frame
+* sends against the 8 latches of a full redraw. */
+#include <stdio.h>
+#include <math.h>
+#include <stubs.h>
+#include <Anim.h>
+#include <Glyph.h>
+#include <animpack.h>
+
+#define MAX_FRAMES  32
+#define REPEAT      2000
+
+static uint8 frames[MAX_FRAMES][ANIM_KEY_SIZE];
+static uint8 stream[2 * MAX_FRAMES * (ANIM_KEY_SIZE + 1)];
+
+static const char *formats[] = { "key", "xor", "rle", "best" };
+
+static void Set(uint8 *frame, int x, int y)
+{
+    if ((x >= 0) && (x < FB_WIDTH) && (y >= 0) && (y < FB_HEIGHT))
+    {
+        frame[(y * ANIM_ROW_BYTES) + (x / 8)] |= 0x80 >> (x % 8);
+    }
+}
+
+/* A bar turning about the middle of the right hand modules */
+static uint16 Spinner(void)
+{
+    uint16 f;
+    int i;
+    double a;
+    
+    memset(frames, 0, sizeof(frames));
+    for (f = 0; f < 16; f++)
+    {
+        a = f * 3.14159265 / 16;
+        for (i = -7; i <= 7; i++)
+        {
+            Set(frames[f], 52 + (int)lround(i * cos(a)), 16 + (int)lround(i * sin(a)));
+        }
+    }
+    return 16;
+}
+
+/* A 4 x 4 ball bouncing off the edges of the panel */
+static uint16 Ball(void)
+{
+    uint16 f;
+    int x = 0;
+    int y = 0;
+    int dx = 3;
+    int dy = 2;
+    int i;
+    
+    memset(frames, 0, sizeof(frames));
+    for (f = 0; f < MAX_FRAMES; f++)
+    {
+        for (i = 0; i < 16; i++)
+        {
+            Set(frames[f], x + (i % 4), y + (i / 4));
+        }
+        if (((x + dx) < 0) || ((x + dx + 4) > FB_WIDTH))
+        {
+            dx = -dx;
+        }
+        if (((y + dy) < 0) || ((y + dy + 4) > FB_HEIGHT))
+        {
+            dy = -dy;
+        }
+        x += dx;
+        y += dy;
+    }
+    return MAX_FRAMES;
+}
+
+/* A word that flashes: on for four frames, off for four */
+static uint16 Flash(void)
+{
+    static const char word[] = "SALE!";
+    const uint8 *columns;
+    uint16 f;
+    uint8 c, x, y;
+    
+    memset(frames, 0, sizeof(frames));
+    for (f = 0; f < 4; f++)
+    {
+        for (c = 0; word[c] != 0; c++)
+        {
+            columns = GlyphColumns((uint8)word[c]);
+            for (x = 0; x < 8; x++)
+            {
+                for (y = 0; y < 8; y++)
+                {
+                    if (columns[x] & (1u << y))
+                    {
+                        Set(frames[f], 12 + (c * 8) + x, 12 + y);
+                    }
+                }
+            }
+        }
+    }
+    return 8;
+}
+
+static uint8 RowsChanged(const uint8 *a, const uint8 *b)
+{
+    uint8 y, rows = 0;
+    
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        rows += (memcmp(&a[y * ANIM_ROW_BYTES], &b[y * ANIM_ROW_BYTES], ANIM_ROW_BYTES) != 0);
+    }
+    return rows;
+}
+
+static int Matches(const uint8 *frame)
+{
+    uint8 y, b;
+    
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        for (b = 0; b < ANIM_ROW_BYTES; b++)
+        {
+            if (FramebufferRowByte(y, b) != frame[(y * ANIM_ROW_BYTES) + b])
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int Upload(uint16 size)
+{
+    uint8 write[ANIM_WRITE_SIZE];
+    uint16 length;
+    uint8 row;
+    
+    for (row = 0; (length = AnimPackRow(stream, size, row, write)) != 0; row++)
+    {
+        if (AnimWrite(write, length) != CYBLE_GATT_ERR_NONE)
+        {
+            return 0;
+        }
+    }
+    return AnimValid();
+}
+
+int main(void)
+{
+    static const struct
+    {
+        const char *name;
+        uint16 (*build)(void);
+    } scenes[] =
+    {
+        { "spinner",    Spinner },
+        { "ball",       Ball },
+        { "flash",      Flash },
+    };
+    uint8 write[ANIM_WRITE_SIZE];
+    uint16 count, size, f;
+    uint32 rows, packets, noops;
+    unsigned s, format, n;
+    double t0, decode;
+    int errors = 0;
+    
+    stubTickRate = ANIM_MAX_FPS;    // a frame every tick
+    FramebufferInit();
+    printf("%u x %u modules, %u bytes a keyframe, %u byte store; a full redraw is %u digit packets\n\n",
+        PANEL_COLUMNS, PANEL_ROWS, ANIM_KEY_SIZE + 1, ANIM_STORE_SIZE, 8 * MODULE_COUNT);
+    printf("%-8s %-5s %7s %9s %9s %8s %11s %10s %8s\n", "anim", "fmt", "frames", "bytes",
+        "B/frame", "rows", "ns/frame", "packets", "noops");
+    
+    for (s = 0; s < sizeof(scenes) / sizeof(scenes[0]); s++)
+    {
+        count = scenes[s].build();
+        rows = 0;
+        for (f = 0; f < count; f++)
+        {
+            rows += RowsChanged(frames[f], frames[(f + count - 1) % count]);
+        }
+        
+        for (format = ANIMPACK_KEY; format <= ANIMPACK_BEST; format++)
+        {
+            size = AnimPack(&frames[0][0], count, format, stream, sizeof(stream));
+            printf("%-8s %-5s %7u %9u %9.1f %8.1f ", scenes[s].name, formats[format], count, size,
+                (double)(size - ANIM_HEADER) / count, (double)rows / count);
+            if (size > ANIM_STORE_SIZE)
+            {
+                printf("%11s\n", "too big");
+                continue;
+            }
+            if (!Upload(size))
+            {
+                printf("%11s\n", "REJECTED");
+                errors++;
+                continue;
+            }
+            
+            /* The keyframe is drawn as playback starts, then a frame a tick
+            * through the sequence and back to it */
+            AnimPlay(ANIM_MAX_FPS);
+            FramebufferCommit();
+            StubReset();
+            for (f = 1; f <= count; f++)
+            {
+                AnimTick();
+                FramebufferCommit();
+                errors += !Matches(frames[f % count]);
+            }
+            packets = stubPackets - stubNoops;
+            noops = stubNoops;
+            
+            t0 = StubTime();
+            for (n = 0; n < (REPEAT * count); n++)
+            {
+                AnimTick();
+            }
+            decode = (StubTime() - t0) * 1e9 / (REPEAT * count);
+            errors += !Matches(frames[0]);
+            printf("%11.1f %10.1f %8.1f\n", decode, (double)packets / count, (double)noops / count);
+        }
+    }
+    
+    /* A corrupted write is refused, and a stream with frames missing is
+    * not played */
+    size = AnimPack(&frames[0][0], count, ANIMPACK_BEST, stream, sizeof(stream));
+    n = AnimPackRow(stream, size, 0, write);
+    write[ANIM_WRITE_HEADER] ^= 1;
+    errors += (AnimWrite(write, n) != CYBLE_GATT_ERR_OUT_OF_RANGE);
+    stream[3]--;
+    errors += Upload(size);
+    
+    if (errors != 0)
+    {
+        printf("%d frames or checks wrong\n", errors);
+        return 1;
+    }
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,164 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <animpack.h>
+#include <Crc.h>
+
+/* Runs of one row's XOR bytes: skips for zeros, except a single zero
+* between changed bytes, which costs less inside the literal run */
+static uint16 Runs(const uint8 *delta, uint8 *out)
+{
+    uint16 o = 0;
+    uint8 b = 0;
+    uint8 n, start;
+    
+    while (b < ANIM_ROW_BYTES)
+    {
+        start = b;
+        if (delta[b] == 0)
+        {
+            while ((b < ANIM_ROW_BYTES) && (delta[b] == 0) && ((b - start) < ANIM_RLE_MAX))
+            {
+                b++;
+            }
+            out[o++] = ANIM_RLE_SKIP | (b - start - 1);
+            continue;
+        }
+        while ((b < ANIM_ROW_BYTES) && ((b - start) < ANIM_RLE_MAX) && ((delta[b] != 0) ||
+            (((b + 1) < ANIM_ROW_BYTES) && (delta[b + 1] != 0) && ((b + 1 - start) < ANIM_RLE_MAX))))
+        {
+            b++;
+        }
+        n = b - start;
+        out[o++] = n - 1;
+        memcpy(&out[o], &delta[start], n);
+        o += n;
+    }
+    return o;
+}
+
+/* One delta frame against 'last' in the given format, into 'out', which
+* must hold a keyframe's worth */
+static uint16 Delta(const uint8 *frame, const uint8 *last, uint8 format, uint8 *out)
+{
+    uint8 delta[ANIM_ROW_BYTES];
+    uint16 o = 1 + ANIM_MASK_BYTES;
+    uint8 y, b, changed;
+    
+    out[0] = format;
+    memset(&out[1], 0, ANIM_MASK_BYTES);
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        changed = 0;
+        for (b = 0; b < ANIM_ROW_BYTES; b++)
+        {
+            delta[b] = frame[(y * ANIM_ROW_BYTES) + b] ^ last[(y * ANIM_ROW_BYTES) + b];
+            changed |= delta[b];
+        }
+        if (!changed)
+        {
+            continue;
+        }
+        out[1 + (y / 8)] |= 0x80 >> (y % 8);
+        if (format == ANIM_FRAME_XOR)
+        {
+            memcpy(&out[o], delta, ANIM_ROW_BYTES);
+            o += ANIM_ROW_BYTES;
+        }
+        else
+        {
+            o += Runs(delta, &out[o]);
+        }
+    }
+    return o;
+}
+
+uint16 AnimPack(const uint8 *frames, uint16 count, uint8 format, uint8 *out, uint16 max)
+{
+    uint8 xor[1 + ANIM_KEY_SIZE + ANIM_MASK_BYTES];
+    uint8 rle[1 + ANIM_MASK_BYTES + (2 * ANIM_KEY_SIZE)];   // a control byte per row byte at worst
+    const uint8 *frame;
+    const uint8 *best;
+    uint16 o = ANIM_HEADER;
+    uint16 size, xorSize, rleSize;
+    uint16 f;
+    
+    if (max < ANIM_HEADER)
+    {
+        return 0;
+    }
+    out[0] = ANIM_MAGIC;
+    out[1] = ANIM_ROW_BYTES;
+    out[2] = FB_HEIGHT;
+    out[3] = (uint8)count;
+    out[4] = (uint8)(count >> 8);
+    
+    for (f = 0; f < count; f++)
+    {
+        frame = &frames[f * ANIM_KEY_SIZE];
+        if ((f == 0) || (format == ANIMPACK_KEY))
+        {
+            xor[0] = ANIM_FRAME_KEY;
+            memcpy(&xor[1], frame, ANIM_KEY_SIZE);
+            best = xor;
+            size = 1 + ANIM_KEY_SIZE;
+        }
+        else
+        {
+            xorSize = Delta(frame, frame - ANIM_KEY_SIZE, ANIM_FRAME_XOR, xor);
+            rleSize = Delta(frame, frame - ANIM_KEY_SIZE, ANIM_FRAME_RLE, rle);
+            if ((format == ANIMPACK_XOR) || ((format == ANIMPACK_BEST) && (xorSize <= rleSize)))
+            {
+                best = xor;
+                size = xorSize;
+            }
+            else
+            {
+                best = rle;
+                size = rleSize;
+            }
+        }
+        if (size > (max - o))
+        {
+            return 0;
+        }
+        memcpy(&out[o], best, size);
+        o += size;
+    }
+    out[5] = (uint8)o;
+    out[6] = (uint8)(o >> 8);
+    return o;
+}
+
+uint16 AnimPackRow(const uint8 *stream, uint16 size, uint8 row, uint8 *out)
+{
+    uint16 start = row * FLASH_ROW_SIZE;
+    uint16 length;
+    uint16 crc;
+    
+    if (start >= size)
+    {
+        return 0;
+    }
+    length = size - start;
+    if (length > FLASH_ROW_SIZE)
+    {
+        length = FLASH_ROW_SIZE;
+    }
+    out[0] = row;
+    memcpy(&out[ANIM_WRITE_HEADER], &stream[start], length);
+    crc = Crc16(Crc16(CRC16_INIT, out, 1), &out[ANIM_WRITE_HEADER], length);
+    out[1] = (uint8)crc;
+    out[2] = (uint8)(crc >> 8);
+    return ANIM_WRITE_HEADER + length;
+}
+
+/* [] END OF FILE */
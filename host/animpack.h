@@ -0,0 +1,32 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _ANIMPACK_H_
+#define _ANIMPACK_H_
+
+#include <Anim.h>
+
+#define ANIMPACK_KEY    0       // every frame a keyframe
+#define ANIMPACK_XOR    1       // deltas as whole XOR rows
+#define ANIMPACK_RLE    2       // deltas as runs of XOR bytes
+#define ANIMPACK_BEST   3       // the smaller of the two for each frame
+
+/* Packs 'count' frames of ANIM_KEY_SIZE bytes, rows as Anim.h lays them out,
+* into the Anim.h stream format. Returns the stream size, or 0 if it would
+* not fit in 'max' bytes. */
+uint16 AnimPack(const uint8 *frames, uint16 count, uint8 format, uint8 *out, uint16 max);
+
+/* The ANIMATION Control write for flash row 'row' of a stream of 'size'
+* bytes. Returns its length, or 0 if the stream ends before that row. */
+uint16 AnimPackRow(const uint8 *stream, uint16 size, uint8 row, uint8 *out);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,76 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Worst-case frame cost of each effect: latches sent per frame, which set the
+* time on target through the SPI_DELAY waits, against the shortest
+* DisplayTimer period, plus the effect's own estimated CPU cycles. The host
+* time is for the whole zone step: render, effect and composite. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Zone.h>
+#include <Framebuffer.h>
+
+#define FRAMES          400
+#define LATCH_US        (3 * SPI_DELAY)     // CS low, packets, CS high waits
+#define FASTEST_DIVIDER 55                  // SPEED Control 200
+
+static const char *names[EFFECT_COUNT] = { "scroll", "wipe", "blink", "vscroll", "bounce", "fade" };
+
+int main(void)
+{
+    static const char *message = "<c>Hi<p5>Billboard effects";
+    TEXT_DESC_T text = { NULL, 0, TEXT_SOURCE_RAM };
+    double periodMs = (DisplayTimer_TC_PERIOD_VALUE + 1.0) * (FASTEST_DIVIDER + 1) / CYDEV_BCLK__HFCLK__HZ * 1000.0;
+    uint8 id;
+    unsigned f;
+    
+    text.text = message;
+    text.length = (uint16)strlen(message);
+    stubTickRate = 8;
+    fbBrightness = 15;
+    FramebufferInit();
+    ZoneInit();
+    
+    printf("shortest tick %.1f ms, one latch ~%u us plus shifting\n\n", periodMs, LATCH_US);
+    printf("%-8s %12s %14s %14s %12s\n", "effect", "est. cycles", "max latches", "worst ms", "host ns");
+    
+    for (id = 0; id < EFFECT_COUNT; id++)
+    {
+        uint32 maxLatches = 0;
+        double t0, spent = 0;
+        
+        ZoneEffect(0, id);
+        ZoneStart(0, &text);
+        for (f = 0; f < FRAMES; f++)
+        {
+            if ((f % 60) == 0)
+            {
+                /* A new message every so often to rerun the transitions */
+                ZoneStart(0, &text);
+            }
+            StubReset();
+            t0 = StubTime();
+            ZoneTick();
+            spent += StubTime() - t0;
+            FramebufferCommit();
+            if (stubLatches > maxLatches)
+            {
+                maxLatches = stubLatches;
+            }
+        }
+        
+        printf("%-8s %12u %14u %14.2f %12.1f\n", names[id], effects[id].cycles, maxLatches,
+            maxLatches * LATCH_US / 1000.0, spent * 1e9 / FRAMES);
+    }
+    return 0;
+}
+
+/* [] END OF FILE */
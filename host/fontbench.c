@@ -0,0 +1,129 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Cost of the font formats fontc writes: packs fonts/cp437.bdf each way,
+* checks every glyph and extent the firmware gets back from it against the
+* source, and prints the flash each takes, the host time of a scrolled column
+* of text and the time of a glyph lookup that has to decode the glyph. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Zone.h>
+#include <Framebuffer.h>
+#include <Glyph.h>
+#include <fontpack.h>
+
+#define COLUMNS     200000
+#define LOOKUPS     2000000
+
+static const struct
+{
+    const char *name;
+    uint8 format;
+    uint8 ascii;
+} variants[] =
+{
+    { "fixed",              0,                                                  0 },
+    { "proportional",       FONT_PROPORTIONAL,                                  0 },
+    { "row-major",          FONT_PROPORTIONAL | FONT_ROW_MAJOR,                 0 },
+    { "packed columns",     FONT_PROPORTIONAL | FONT_PACKED,                    0 },
+    { "packed rows",        FONT_PROPORTIONAL | FONT_ROW_MAJOR | FONT_PACKED,   0 },
+    { "ASCII, packed",      FONT_PROPORTIONAL | FONT_PACKED,                    1 },
+};
+
+static const char sample[] = "Doors open at 9, last entry 17:30. Have a nice day!";
+
+/* Every byte must come back as the source drew it, or as GLYPH_MISSING if
+* the subset left it out, with the extent the proportional font gives it */
+static unsigned Verify(const FONT_SOURCE_T *source, const uint8 *subset, uint8 format, const uint8 *extents)
+{
+    const uint8 *expect;
+    unsigned errors = 0;
+    unsigned c;
+    uint8 kept, extent;
+    
+    for (c = 0; c < 256; c++)
+    {
+        kept = source->present[c] && ((subset == NULL) || subset[c]);
+        expect = source->columns[kept ? c : GLYPH_MISSING];
+        extent = !(format & FONT_PROPORTIONAL) ? 0x08 : extents[kept ? c : GLYPH_MISSING];
+        if ((memcmp(GlyphColumns(GLYPH_RAW_BYTE | c), expect, 8) != 0) ||
+            (GlyphExtent(GLYPH_RAW_BYTE | c) != extent))
+        {
+            printf("  glyph 0x%02X differs\n", c);
+            errors++;
+        }
+    }
+    return errors;
+}
+
+int main(void)
+{
+    static FONT_SOURCE_T source;
+    static FONT_TABLES_T reference, tables;
+    TEXT_DESC_T text = { sample, sizeof(sample) - 1, TEXT_SOURCE_RAM };
+    static volatile uint8 sink;
+    uint8 ascii[256];
+    const uint8 *subset;
+    unsigned v, n, errors = 0;
+    double t0, column, decode;
+    
+    if (FontLoad("fonts/cp437.bdf", &source) != 0)
+    {
+        return 1;
+    }
+    FontPack(&source, FONT_PROPORTIONAL, NULL, &reference);
+    memset(ascii, 0, sizeof(ascii));
+    memset(&ascii[0x20], 1, 0x7F - 0x20);
+    
+    stubTickRate = 1000;
+    FramebufferInit();
+    ZoneInit();
+    printf("%-16s %7s %7s %12s %12s\n", "font", "glyphs", "flash", "ns/column", "ns/decode");
+    for (v = 0; v < sizeof(variants) / sizeof(variants[0]); v++)
+    {
+        subset = variants[v].ascii ? ascii : NULL;
+        FontPack(&source, variants[v].format, subset, &tables);
+        GlyphFont(&tables.font);
+        errors += Verify(&source, subset, variants[v].format, reference.extents);
+    
+        ZoneSpacing(0, (variants[v].format & FONT_PROPORTIONAL) ? RENDER_SPACING : RENDER_FIXED);
+        ZoneStart(0, &text);
+        t0 = StubTime();
+        for (n = 0; n < COLUMNS; n++)
+        {
+            ZoneTick();
+        }
+        column = (StubTime() - t0) * 1e9 / COLUMNS;
+    
+        /* Printable ASCII in turn is more than the cache holds, so a font
+        * that is not drawn from flash decodes the glyph every time */
+        t0 = StubTime();
+        for (n = 0; n < LOOKUPS; n++)
+        {
+            sink ^= GlyphColumns(0x20 + (n % 95))[n % 8];
+        }
+        decode = (StubTime() - t0) * 1e9 / LOOKUPS;
+    
+        printf("%-16s %7u %7u %12.1f %12.1f\n", variants[v].name, tables.font.count,
+            FontFlash(&tables), column, decode);
+    }
+    GlyphFont(&font);
+    
+    if (errors != 0)
+    {
+        printf("%u glyphs decoded wrong\n", errors);
+        return 1;
+    }
+    printf("all glyphs decode as in the source\n");
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,114 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Font compiler: turns a BDF or PSF bitmap font into a font.c for the
+* firmware. 'make font' runs it on fonts/cp437.bdf with FONTFLAGS. */
+#include <stdlib.h>
+#include <unistd.h>
+#include <fontpack.h>
+
+static void Usage(void)
+{
+    fprintf(stderr,
+        "usage: fontc [-p] [-r] [-z] [-s ranges] [-n name] [-o file] font.bdf|font.psf\n"
+        "  -p  proportional: text uses each glyph's lit columns\n"
+        "  -r  row-major: a byte per pixel row instead of per column\n"
+        "  -z  packed: store only the lit columns, or rows, of each glyph\n"
+        "  -s  CP437 bytes to keep, in hex, e.g. 20-7E,B0-DF; all by default\n"
+        "  -n  name of the FONT_T, font by default\n"
+        "  -o  file to write, standard output by default\n");
+    exit(2);
+}
+
+/* "20-7E,B0-DF": ranges or single bytes, in hex */
+static void Subset(const char *arg, uint8 *subset)
+{
+    unsigned long from, to;
+    char *end;
+    
+    memset(subset, 0, 256);
+    while (*arg)
+    {
+        from = strtoul(arg, &end, 16);
+        to = from;
+        if (*end == '-')
+        {
+            to = strtoul(end + 1, &end, 16);
+        }
+        if ((end == arg) || (from > to) || (to > 0xFF) || ((*end != ',') && (*end != 0)))
+        {
+            fprintf(stderr, "fontc: bad subset '%s'\n", arg);
+            exit(2);
+        }
+        memset(&subset[from], 1, to - from + 1);
+        arg = (*end == ',') ? (end + 1) : end;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static FONT_SOURCE_T source;
+    static FONT_TABLES_T tables;
+    uint8 subset[256];
+    uint8 *keep = NULL;
+    uint8 format = 0;
+    const char *name = "font";
+    const char *path = NULL;
+    const char *from;
+    FILE *out = stdout;
+    int opt;
+    
+    while ((opt = getopt(argc, argv, "przs:n:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'p': format |= FONT_PROPORTIONAL; break;
+            case 'r': format |= FONT_ROW_MAJOR; break;
+            case 'z': format |= FONT_PACKED; break;
+            case 's': Subset(optarg, subset); keep = subset; break;
+            case 'n': name = optarg; break;
+            case 'o': path = optarg; break;
+            default: Usage();
+        }
+    }
+    if (optind != (argc - 1))
+    {
+        Usage();
+    }
+    
+    if (FontLoad(argv[optind], &source) != 0)
+    {
+        return 1;
+    }
+    FontPack(&source, format, keep, &tables);
+    if (tables.font.count == 0)
+    {
+        fprintf(stderr, "fontc: no glyphs left to write\n");
+        return 1;
+    }
+    
+    if ((path != NULL) && ((out = fopen(path, "wb")) == NULL))
+    {
+        perror(path);
+        return 1;
+    }
+    from = strrchr(argv[optind], '/');
+    FontWrite(out, &tables, name, (from != NULL) ? (from + 1) : argv[optind]);
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+    fprintf(stderr, "fontc: %u glyphs from 0x%02X, %u bytes of flash\n",
+        tables.font.count, tables.font.first, FontFlash(&tables));
+    return 0;
+}
+
+/* [] END OF FILE */
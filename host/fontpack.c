@@ -0,0 +1,530 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* The font compiler behind fontc and fontbench: reads BDF and PSF bitmap
+* fonts and lays them out in the formats of font.h. */
+#include <stdlib.h>
+#include <fontpack.h>
+
+/* The code point of each CP437 byte, with the symbols CP437 shows for the
+* control bytes 0x01-0x1F and 0x7F */
+static const uint16 cp437Unicode[256] =
+{
+    0x0000, 0x263A, 0x263B, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022,
+    0x25D8, 0x25CB, 0x25D9, 0x2642, 0x2640, 0x266A, 0x266B, 0x263C,
+    0x25BA, 0x25C4, 0x2195, 0x203C, 0x00B6, 0x00A7, 0x25AC, 0x21A8,
+    0x2191, 0x2193, 0x2192, 0x2190, 0x221F, 0x2194, 0x25B2, 0x25BC,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x2302,
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+    0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+
+static const char banner[] =
+    "/* ========================================\r\n"
+    " *\r\n"
+    " * Copyright YOUR COMPANY, THE YEAR\r\n"
+    " * All Rights Reserved\r\n"
+    " * UNPUBLISHED, LICENSED SOFTWARE.\r\n"
+    " *\r\n"
+    " * CONFIDENTIAL AND PROPRIETARY INFORMATION\r\n"
+    " * WHICH IS THE PROPERTY OF your company.\r\n"
+    " *\r\n"
+    " * ========================================\r\n"
+    "*/\r\n";
+
+static const char *flagNames[3] = { "FONT_PROPORTIONAL", "FONT_ROW_MAJOR", "FONT_PACKED" };
+
+static int Cp437(long code)
+{
+    int c;
+    
+    for (c = 0; c < 256; c++)
+    {
+        if (cp437Unicode[c] == code)
+        {
+            return c;
+        }
+    }
+    return -1;
+}
+
+static void SetPixel(FONT_SOURCE_T *source, int c, int x, int y, unsigned *clipped)
+{
+    if ((x < 0) || (x > 7) || (y < 0) || (y > 7))
+    {
+        (*clipped)++;
+        return;
+    }
+    source->columns[c][x] |= (uint8)(1 << y);
+}
+
+static uint32 Le32(const uint8 *p)
+{
+    return p[0] | ((uint32)p[1] << 8) | ((uint32)p[2] << 16) | ((uint32)p[3] << 24);
+}
+
+/* PSF1 and PSF2 console fonts: rows of whole bytes, MSB the leftmost pixel */
+static int LoadPsf(const char *path, const uint8 *data, long size, FONT_SOURCE_T *source, unsigned *clipped)
+{
+    uint32 header, glyphs, bytes, height, width;
+    uint32 c, x, y;
+    
+    if (data[0] == 0x36)
+    {
+        header = 4;
+        glyphs = (data[2] & 0x01) ? 512 : 256;
+        bytes = data[3];
+        height = data[3];
+        width = 8;
+    }
+    else
+    {
+        if (size < 32)
+        {
+            fprintf(stderr, "%s: truncated PSF2 header\n", path);
+            return -1;
+        }
+        header = Le32(&data[8]);
+        glyphs = Le32(&data[16]);
+        bytes = Le32(&data[20]);
+        height = Le32(&data[24]);
+        width = Le32(&data[28]);
+    }
+    if ((height > 8) || (width > 8))
+    {
+        fprintf(stderr, "%s: glyphs are %u x %u pixels, the panel has room for 8 x 8\n",
+            path, (unsigned)width, (unsigned)height);
+        return -1;
+    }
+    if ((header + (glyphs * bytes)) > (uint32)size)
+    {
+        fprintf(stderr, "%s: truncated, %u glyphs of %u bytes do not fit\n", path, (unsigned)glyphs, (unsigned)bytes);
+        return -1;
+    }
+    
+    for (c = 0; (c < glyphs) && (c < 256); c++)
+    {
+        for (y = 0; y < height; y++)
+        {
+            for (x = 0; x < width; x++)
+            {
+                if (data[header + (c * bytes) + y] & (0x80 >> x))
+                {
+                    SetPixel(source, c, x, y, clipped);
+                }
+            }
+        }
+        source->present[c] = 1;
+    }
+    return 0;
+}
+
+/* BDF: each glyph's box is placed against the font's baseline, so the cell
+* holds FONT_ASCENT rows above it and FONT_DESCENT below */
+static int LoadBdf(const char *path, char *text, FONT_SOURCE_T *source, unsigned *clipped)
+{
+    int ascent = -1, descent = -1;
+    int boxH = 0, boxY = 0;
+    int c = -1, w = 0, h = 0, xo = 0, yo = 0;
+    int row = -1, x;
+    unsigned skipped = 0;
+    unsigned long long bits;
+    long code;
+    char *line, *end;
+    size_t digits;
+    
+    for (line = strtok(text, "\r\n"); line != NULL; line = strtok(NULL, "\r\n"))
+    {
+        if (row >= 0)
+        {
+            if (strncmp(line, "ENDCHAR", 7) == 0)
+            {
+                if (c >= 0)
+                {
+                    source->present[c] = 1;
+                }
+                row = -1;
+                continue;
+            }
+            digits = strspn(line, "0123456789ABCDEFabcdef");
+            bits = strtoull(line, &end, 16);
+            for (x = 0; (c >= 0) && (x < w) && (x < (int)(digits * 4)); x++)
+            {
+                if ((bits >> ((digits * 4) - 1 - x)) & 1)
+                {
+                    SetPixel(source, c, xo + x, ascent - (yo + h) + row, clipped);
+                }
+            }
+            row++;
+        }
+        else if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1)
+        {
+        }
+        else if (sscanf(line, "FONT_DESCENT %d", &descent) == 1)
+        {
+        }
+        else if (sscanf(line, "FONTBOUNDINGBOX %*d %d %*d %d", &boxH, &boxY) == 2)
+        {
+        }
+        else if (strncmp(line, "STARTCHAR", 9) == 0)
+        {
+            if (ascent < 0)
+            {
+                ascent = boxH + boxY;
+            }
+            if (descent < 0)
+            {
+                descent = -boxY;
+            }
+            if ((ascent + descent) > 8)
+            {
+                fprintf(stderr, "%s: the font is %d pixels high, the panel has 8\n", path, ascent + descent);
+                return -1;
+            }
+            c = -1;
+        }
+        else if (sscanf(line, "ENCODING %ld", &code) == 1)
+        {
+            c = Cp437(code);
+            skipped += (c < 0);
+        }
+        else if (sscanf(line, "BBX %d %d %d %d", &w, &h, &xo, &yo) == 4)
+        {
+        }
+        else if (strncmp(line, "BITMAP", 6) == 0)
+        {
+            row = 0;
+        }
+    }
+    if (skipped != 0)
+    {
+        fprintf(stderr, "%s: %u glyphs have no place in CP437 and were left out\n", path, skipped);
+    }
+    return 0;
+}
+
+int FontLoad(const char *path, FONT_SOURCE_T *source)
+{
+    FILE *f = fopen(path, "rb");
+    uint8 *data;
+    long size;
+    unsigned clipped = 0;
+    int result;
+    
+    memset(source, 0, sizeof(*source));
+    if (f == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc(size + 1);
+    if ((data == NULL) || (fread(data, 1, size, f) != (size_t)size))
+    {
+        fprintf(stderr, "%s: could not be read\n", path);
+        fclose(f);
+        free(data);
+        return -1;
+    }
+    fclose(f);
+    data[size] = 0;
+    
+    if ((size >= 4) && (((data[0] == 0x36) && (data[1] == 0x04)) ||
+        ((data[0] == 0x72) && (data[1] == 0xB5) && (data[2] == 0x4A) && (data[3] == 0x86))))
+    {
+        result = LoadPsf(path, data, size, source, &clipped);
+    }
+    else if (strncmp((const char *)data, "STARTFONT", 9) == 0)
+    {
+        result = LoadBdf(path, (char *)data, source, &clipped);
+    }
+    else
+    {
+        fprintf(stderr, "%s: not a BDF or PSF font\n", path);
+        result = -1;
+    }
+    free(data);
+    
+    if (clipped != 0)
+    {
+        fprintf(stderr, "%s: %u pixels outside the 8 x 8 cell were dropped\n", path, clipped);
+    }
+    return result;
+}
+
+/* The lit columns of a glyph, the way the firmware works them out for the
+* glyphs it composes (Glyph.c) */
+static uint8 Extent(int c, const uint8 *columns)
+{
+    int first = 0;
+    int last = 7;
+    
+    if ((c >= 0xB0) && (c <= 0xDF))
+    {
+        return 0x08;
+    }
+    while ((first < 8) && (columns[first] == 0))
+    {
+        first++;
+    }
+    if (first == 8)
+    {
+        return FONT_SPACE_WIDTH;
+    }
+    while (columns[last] == 0)
+    {
+        last--;
+    }
+    return (uint8)((first << 4) | (last - first + 1));
+}
+
+/* Pixel rows of a glyph, MSB the leftmost pixel */
+static void Rows(const uint8 *columns, uint8 *rows)
+{
+    int x, y;
+    
+    for (y = 0; y < 8; y++)
+    {
+        rows[y] = 0;
+        for (x = 0; x < 8; x++)
+        {
+            if (columns[x] & (1 << y))
+            {
+                rows[y] |= (uint8)(0x80 >> x);
+            }
+        }
+    }
+}
+
+void FontPack(const FONT_SOURCE_T *source, uint8 format, const uint8 *subset, FONT_TABLES_T *tables)
+{
+    static const uint8 blank[8] = {0};
+    int first = -1, last = -1;
+    int holes = 0;
+    int c, i, top, bottom;
+    const uint8 *columns;
+    uint8 rows[8];
+    uint8 *out;
+    
+    memset(tables, 0, sizeof(*tables));
+    for (c = 0; c < 256; c++)
+    {
+        if (source->present[c] && ((subset == NULL) || subset[c]))
+        {
+            first = (first < 0) ? c : first;
+            last = c;
+        }
+    }
+    
+    for (c = first; (first >= 0) && (c <= last); c++)
+    {
+        i = c - first;
+        columns = source->columns[c];
+        if (!source->present[c] || ((subset != NULL) && !subset[c]))
+        {
+            columns = blank;
+            holes = 1;
+            tables->extents[i] = FONT_EXTENT_NONE;
+        }
+        else
+        {
+            tables->extents[i] = Extent(c, columns);
+        }
+        if ((i % 16) == 0)
+        {
+            tables->blocks[i / 16] = tables->glyphSize;
+        }
+        
+        out = &tables->glyphs[tables->glyphSize];
+        Rows(columns, rows);
+        if (!(format & FONT_PACKED))
+        {
+            memcpy(out, (format & FONT_ROW_MAJOR) ? rows : columns, 8);
+            tables->glyphSize += 8;
+        }
+        else if (!(format & FONT_ROW_MAJOR))
+        {
+            memcpy(out, &columns[FONT_EXTENT_FIRST(tables->extents[i])], FONT_EXTENT_WIDTH(tables->extents[i]));
+            tables->glyphSize += FONT_EXTENT_WIDTH(tables->extents[i]);
+        }
+        else
+        {
+            for (top = 0; (top < 8) && (rows[top] == 0); top++)
+            {
+            }
+            for (bottom = 7; (bottom >= top) && (rows[bottom] == 0); bottom--)
+            {
+            }
+            out[0] = (top < 8) ? (uint8)((top << 4) | (bottom - top + 1)) : 0;
+            memcpy(&out[1], &rows[FONT_EXTENT_FIRST(out[0])], FONT_EXTENT_WIDTH(out[0]));
+            tables->glyphSize += 1 + FONT_EXTENT_WIDTH(out[0]);
+        }
+    }
+    
+    tables->font.format = format;
+    tables->font.first = (uint8)((first < 0) ? 0 : first);
+    tables->font.count = (uint16)((first < 0) ? 0 : (last - first + 1));
+    tables->font.glyphs = tables->glyphs;
+    tables->font.extents = NULL;
+    tables->font.blocks = NULL;
+    if ((format & FONT_PROPORTIONAL) || ((format & FONT_PACKED) && !(format & FONT_ROW_MAJOR)) || holes)
+    {
+        tables->font.extents = tables->extents;
+    }
+    if (format & FONT_PACKED)
+    {
+        tables->font.blocks = tables->blocks;
+    }
+}
+
+uint16 FontFlash(const FONT_TABLES_T *tables)
+{
+    const FONT_T *f = &tables->font;
+    
+    /* The FONT_T itself is 16 bytes on the M0: 4 of fields and 3 pointers */
+    return tables->glyphSize + ((f->extents != NULL) ? f->count : 0) +
+        ((f->blocks != NULL) ? (2 * ((f->count + 15) / 16)) : 0) + 16;
+}
+
+static void Comment(FILE *out, int c)
+{
+    if ((c > 0x20) && (c < 0x7F))
+    {
+        fprintf(out, "// 0x%02X '%c'\r\n", c, c);
+    }
+    else
+    {
+        fprintf(out, "// 0x%02X\r\n", c);
+    }
+}
+
+void FontWrite(FILE *out, const FONT_TABLES_T *tables, const char *name, const char *from)
+{
+    const FONT_T *f = &tables->font;
+    uint16 offset = 0;
+    uint16 size;
+    int i, b;
+    
+    fputs(banner, out);
+    fprintf(out, "/* Written by host/fontc from %s: %s, %s%s,\r\n"
+        "* %u glyphs from 0x%02X, %u bytes of flash. Do not edit; see make -C host font. */\r\n",
+        from, (f->format & FONT_PROPORTIONAL) ? "proportional" : "fixed width",
+        (f->format & FONT_ROW_MAJOR) ? "row-major" : "column-major",
+        (f->format & FONT_PACKED) ? ", packed" : "", f->count, f->first, FontFlash(tables));
+    fprintf(out, "#include <font.h>\r\n\r\n");
+    
+    fprintf(out, "static const uint8 %sGlyphs [%u] = {\r\n", name, tables->glyphSize);
+    for (i = 0; i < f->count; i++)
+    {
+        if (!(f->format & FONT_PACKED))
+        {
+            size = 8;
+        }
+        else if (!(f->format & FONT_ROW_MAJOR))
+        {
+            size = FONT_EXTENT_WIDTH(tables->extents[i]);
+        }
+        else
+        {
+            size = 1 + FONT_EXTENT_WIDTH(tables->glyphs[offset]);
+        }
+        fputs("  ", out);
+        for (b = 0; b < size; b++)
+        {
+            fprintf(out, "0x%02X, ", tables->glyphs[offset + b]);
+        }
+        Comment(out, f->first + i);
+        offset += size;
+    }
+    fprintf(out, "};\r\n");
+    
+    if (f->extents != NULL)
+    {
+        fprintf(out, "\r\n// lit columns of each glyph, (first << 4) | count, see font.h\r\n");
+        fprintf(out, "static const uint8 %sExtents [%u] = {\r\n", name, f->count);
+        for (i = 0; i < f->count; i += 8)
+        {
+            fputs(" ", out);
+            for (b = i; (b < (i + 8)) && (b < f->count); b++)
+            {
+                fprintf(out, " 0x%02X,", f->extents[b]);
+            }
+            fprintf(out, " // 0x%02X\r\n", f->first + i);
+        }
+        fprintf(out, "};\r\n");
+    }
+    if (f->blocks != NULL)
+    {
+        fprintf(out, "\r\n// where every 16th glyph starts in %sGlyphs\r\n", name);
+        fprintf(out, "static const uint16 %sBlocks [%u] = {\r\n ", name, (f->count + 15) / 16);
+        for (i = 0; i < ((f->count + 15) / 16); i++)
+        {
+            fprintf(out, " %u,", tables->blocks[i]);
+        }
+        fprintf(out, "\r\n};\r\n");
+    }
+    
+    fprintf(out, "\r\nconst FONT_T %s = { ", name);
+    for (b = 0; b < 3; b++)
+    {
+        if (f->format & (1 << b))
+        {
+            fprintf(out, "%s%s", (f->format & ((1 << b) - 1)) ? " | " : "", flagNames[b]);
+        }
+    }
+    fprintf(out, "%s, 0x%02X, %u, %sGlyphs, ", (f->format == 0) ? "0" : "", f->first, f->count, name);
+    if (f->extents != NULL)
+    {
+        fprintf(out, "%sExtents, ", name);
+    }
+    else
+    {
+        fputs("NULL, ", out);
+    }
+    if (f->blocks != NULL)
+    {
+        fprintf(out, "%sBlocks };\r\n", name);
+    }
+    else
+    {
+        fputs("NULL };\r\n", out);
+    }
+    fprintf(out, "\r\n/* [] END OF FILE */\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,55 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _FONTPACK_H_
+#define _FONTPACK_H_
+
+#include <stdio.h>
+#include <font.h>
+
+#define FONTPACK_MAX    (256 * 9)   // glyph bytes at most: packed rows take a header byte
+
+/* A font as read from its file: the glyph of every CP437 byte it has, one
+* byte per column, bit 0 at the top */
+typedef struct
+{
+    uint8 columns[256][8];
+    uint8 present[256];
+} FONT_SOURCE_T;
+
+/* The tables fontc writes, with a FONT_T pointing at them so the host can
+* draw with them too */
+typedef struct
+{
+    FONT_T font;
+    uint8 glyphs[FONTPACK_MAX];
+    uint16 glyphSize;
+    uint8 extents[256];
+    uint16 blocks[16];
+} FONT_TABLES_T;
+
+/* Reads a BDF or PSF font. Returns 0, or prints why not and returns -1. BDF
+* encodings are Unicode and are mapped to CP437; PSF glyphs are taken as
+* CP437 in file order. */
+int FontLoad(const char *path, FONT_SOURCE_T *source);
+
+/* Lays the glyphs of 'source' out in a FONT_ format. 'subset' flags the CP437
+* bytes to keep, or NULL for all of them. */
+void FontPack(const FONT_SOURCE_T *source, uint8 format, const uint8 *subset, FONT_TABLES_T *tables);
+
+/* Flash the tables and their FONT_T take on the Cortex-M0 */
+uint16 FontFlash(const FONT_TABLES_T *tables);
+
+/* Writes the tables as a font.c for the firmware */
+void FontWrite(FILE *out, const FONT_TABLES_T *tables, const char *name, const char *from);
+
+#endif
+/* [] END OF FILE */
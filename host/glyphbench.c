@@ -0,0 +1,124 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Cost of UTF-8 text: the flash and RAM the glyph store and cache take, the
+* host time of a scrolled column for text in a few scripts against plain
+* ASCII, the columns a scroll cycle takes in proportional text against cells
+* of 8, and the time of a glyph lookup that hits the cache against one that
+* has to search the store. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Zone.h>
+#include <Framebuffer.h>
+#include <Glyph.h>
+
+#define COLUMNS     200000
+#define LOOKUPS     2000000
+
+static const struct
+{
+    const char *name;
+    const char *text;
+} samples[] =
+{
+    { "ASCII",      "Doors open at 9, last entry 17:30. Have a nice day!" },
+    { "Polish",     "Za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87 g\xC4\x99\xC5\x9Bl\xC4\x85 ja\xC5\xBA\xC5\x84, wej\xC5\x9B" "cie od 9:00" },
+    { "Czech",      "P\xC5\x99\xC3\xAD\xC5\xA1" "ern\xC4\x9B \xC5\xBElu\xC5\xA5ou\xC4\x8Dk\xC3\xBD k\xC5\xAF\xC5\x88 \xC3\xBAp\xC4\x9Bl \xC4\x8F\xC3\xA1" "belsk\xC3\xA9 \xC3\xB3" "dy" },
+    { "Russian",    "\xD0\x94\xD0\xBE\xD0\xB1\xD1\x80\xD0\xBE \xD0\xBF\xD0\xBE\xD0\xB6\xD0\xB0\xD0\xBB\xD0\xBE\xD0\xB2\xD0\xB0\xD1\x82\xD1\x8C! \xD0\x92\xD1\x85\xD0\xBE\xD0\xB4 \xD1\x81 9:00" },
+    { "Greek",      "\xCE\x9A\xCE\xB1\xCE\xBB\xCF\x89\xCF\x83\xCE\xAE\xCF\x81\xCE\xB8\xCE\xB1\xCF\x84\xCE\xB5 \xCE\xB1\xCF\x80\xCF\x8C 9:00" },
+    { "symbols",    "\xE2\x82\xAC" "5 \xE2\x80\x93 \xE2\x98\xBA \xE2\x99\xA5 \xE2\x86\x92 20\xC2\xB0" "C \xE2\x80\xA6" },
+};
+
+int main(void)
+{
+    TEXT_DESC_T text = { NULL, 0, TEXT_SOURCE_RAM };
+    static volatile uint8 sink;
+    uint16 extra = 0;
+    uint16 i;
+    unsigned s, n, fixed, narrow;
+    double t0, ascii = 0, ns;
+    
+    for (i = 0; i < glyphStoreCount; i++)
+    {
+        if ((glyphStore[i].mark & GLYPH_EXTRA) && (glyphStore[i].base >= extra))
+        {
+            extra = glyphStore[i].base + 1;
+        }
+    }
+    printf("flash: %u code points in %u bytes of store, %u extra glyphs in %u, marks %u, total %u bytes\n",
+        glyphStoreCount, (unsigned)(glyphStoreCount * sizeof(GLYPH_ENTRY_T)), extra, extra * 8u,
+        (unsigned)sizeof(glyphMarks),
+        (unsigned)(glyphStoreCount * sizeof(GLYPH_ENTRY_T) + (extra * 8u) + sizeof(glyphMarks)));
+    printf("RAM: %u cache slots, %u bytes with their tags and extents\n\n", GLYPH_CACHE_SLOTS, GLYPH_CACHE_SLOTS * 14);
+    
+    stubTickRate = 1000;
+    FramebufferInit();
+    ZoneInit();
+    printf("%-10s %8s %8s %12s %10s\n", "text", "bytes", "chars", "ns/column", "vs ASCII");
+    for (s = 0; s < sizeof(samples) / sizeof(samples[0]); s++)
+    {
+        text.text = samples[s].text;
+        text.length = (uint16)strlen(samples[s].text);
+        ZoneStart(0, &text);
+        t0 = StubTime();
+        for (n = 0; n < COLUMNS; n++)
+        {
+            ZoneTick();
+        }
+        ns = (StubTime() - t0) * 1e9 / COLUMNS;
+        if (s == 0)
+        {
+            ascii = ns;
+        }
+        printf("%-10s %8u %8u %12.1f %9.2fx\n", samples[s].name, text.length,
+            Utf8Count(text.text, text.length), ns, ns / ascii);
+    }
+    
+    /* A cycle scrolls the text in, then the zone empty */
+    printf("\n%-10s %12s %14s %8s\n", "text", "fixed cycle", "proportional", "saved");
+    for (s = 0; s < sizeof(samples) / sizeof(samples[0]); s++)
+    {
+        text.text = samples[s].text;
+        text.length = (uint16)strlen(samples[s].text);
+        ZoneSpacing(0, RENDER_FIXED);
+        ZoneStart(0, &text);
+        fixed = zones[0].render.columns + FB_COLUMNS;
+        ZoneSpacing(0, RENDER_SPACING);
+        ZoneStart(0, &text);
+        narrow = zones[0].render.columns + FB_COLUMNS;
+        printf("%-10s %12u %14u %7.0f%%\n", samples[s].name, fixed, narrow, 100.0 * (fixed - narrow) / fixed);
+    }
+    
+    /* One code point over and over hits the last slot; more than the cache
+    * holds in turn misses every time */
+    t0 = StubTime();
+    for (n = 0; n < LOOKUPS; n++)
+    {
+        sink ^= GlyphColumns('A')[n % 8];
+    }
+    ns = (StubTime() - t0) * 1e9 / LOOKUPS;
+    printf("\nlookup ns: ASCII %.1f", ns);
+    t0 = StubTime();
+    for (n = 0; n < LOOKUPS; n++)
+    {
+        sink ^= GlyphColumns(0x0105)[n % 8];
+    }
+    printf(", cached %.1f", (StubTime() - t0) * 1e9 / LOOKUPS);
+    t0 = StubTime();
+    for (n = 0; n < LOOKUPS; n++)
+    {
+        sink ^= GlyphColumns(0x0410 + (n % (GLYPH_CACHE_SLOTS + 1)))[n % 8];
+    }
+    printf(", miss %.1f\n", (StubTime() - t0) * 1e9 / LOOKUPS);
+    return 0;
+}
+
+/* [] END OF FILE */
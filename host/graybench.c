@@ -0,0 +1,119 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Grayscale depth against chain length. The sub-frame scheduler in Gray.c is
+* run against the stubs to check the plane weights and the latches each
+* sub-frame sends, then the same timing model as Gray.h is evaluated for
+* chains of 1 to 16 modules to find the deepest image that still refreshes at
+* GRAY_MIN_REFRESH. Latch times are modeled from the SPI bit rate, not
+* measured on target. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Gray.h>
+#include <Framebuffer.h>
+
+#define MAX_CHAIN       16
+#define SLOW_LATCH_US   (3 * SPI_DELAY)     // FramebufferCommit with its CS waits
+
+/* Whole-image time for 'depth' planes with a given latch time */
+static double RefreshHz(double latchUs, uint8 depth)
+{
+    double lsbUs = 2.0 * 8.0 * latchUs;
+    
+    return 1e6 / (((1u << depth) - 1) * lsbUs);
+}
+
+static uint8 MaxDepth(double latchUs)
+{
+    uint8 depth = 0;
+    
+    while ((depth < 8) && (RefreshHz(latchUs, depth + 1) >= GRAY_MIN_REFRESH))
+    {
+        depth++;
+    }
+    return depth;
+}
+
+int main(void)
+{
+    uint8 planes[GRAY_MAX_DEPTH][FB_COLUMNS];
+    uint32 latches[GRAY_MAX_DEPTH] = {0};
+    uint32 periods[GRAY_MAX_DEPTH] = {0};
+    uint32 total = 0;
+    uint8 p, n;
+    unsigned f;
+    int fail = 0;
+    
+    /* Levels 5 and 10 in alternate rows: every plane differs from the one
+    * before it in every column, so each sub-frame rewrites all 8 digits */
+    for (p = 0; p < GRAY_MAX_DEPTH; p++)
+    {
+        memset(planes[p], (p & 1) ? 0xAA : 0x55, FB_COLUMNS);
+    }
+    
+    FramebufferInit();
+    StubReset();
+    GrayShow(&planes[0][0], GRAY_MAX_DEPTH);
+    for (f = 0; f < 4 * GRAY_MAX_DEPTH; f++)
+    {
+        p = f % GRAY_MAX_DEPTH;
+        StubReset();
+        GrayTick();
+        if (stubLatches > latches[p])
+        {
+            latches[p] = stubLatches;
+        }
+        periods[p] = stubPeriod + 1;
+    }
+    
+    printf("MODULE_COUNT %u, depth %u, timer divider %u (1 us counts)\n", MODULE_COUNT, GRAY_MAX_DEPTH, stubDivider);
+    printf("%-6s %10s %10s\n", "plane", "hold us", "latches");
+    for (p = 0; p < GRAY_MAX_DEPTH; p++)
+    {
+        printf("%-6u %10u %10u\n", p, periods[p], latches[p]);
+        total += periods[p];
+        if ((periods[p] != (periods[0] << p)) || (latches[p] > 8))
+        {
+            fail = 1;
+        }
+    }
+    printf("image %u us, %.1f Hz; a sub-frame's latches take %u us of the %u us LSB\n\n",
+        total, 1e6 / total, 8 * GRAY_LATCH_US, GRAY_LSB_US);
+    if ((1e6 / total) < GRAY_MIN_REFRESH)
+    {
+        fail = 1;
+    }
+    
+    printf("deepest image at %u Hz (SPI %u bit/s)\n", GRAY_MIN_REFRESH, GRAY_SPI_HZ);
+    printf("%-8s %10s %10s %12s %14s\n", "modules", "latch us", "max depth", "refresh Hz", "with CS waits");
+    for (n = 1; n <= MAX_CHAIN; n++)
+    {
+        double latchUs = (n * 16.0 * 1e6) / GRAY_SPI_HZ + GRAY_CS_US;
+        double slowUs = SLOW_LATCH_US + (n * 16.0 * 1e6) / GRAY_SPI_HZ;
+        uint8 depth = MaxDepth(latchUs);
+        
+        printf("%-8u %10.0f %10u %12.1f %14u%s\n", n, latchUs, depth,
+            depth ? RefreshHz(latchUs, depth) : 0.0, MaxDepth(slowUs),
+            (n == MODULE_COUNT) ? "   <- this panel" : "");
+        if ((n == MODULE_COUNT) && (depth != GRAY_MAX_DEPTH))
+        {
+            fail = 1;
+        }
+    }
+    
+    if (fail)
+    {
+        printf("\nFAIL: scheduler or GRAY_MAX_DEPTH does not match the model\n");
+    }
+    return fail;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,128 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Packed message benchmark: compression ratio, decode cost per scroll column
+* and upload size for typical billboard text, checking every round trip. */
+#include <stdio.h>
+#include <stubs.h>
+#include <lzpack.h>
+
+#define LL_PAYLOAD      27      // BLE 4.1 link layer payload without length extension
+#define ATT_OVERHEAD    7       // L2CAP header and ATT write opcode + handle
+#define PDU_US          676     // full PDU, empty ack and both IFS at 1 Mbps
+#define RUNS            2000
+
+static const char *corpus[] =
+{
+    "PSoC Rocks!!",
+    "OPEN 24 HOURS",
+    "Welcome to the Engineering Open House - Demos in Room 101, 102 and 103",
+    "SALE SALE SALE  50% OFF  SALE SALE SALE  50% OFF  SALE SALE SALE",
+    "Next train: 10:42 Downtown  10:49 Airport  10:55 Downtown  11:02 Airport",
+    "Temperature 21C  Humidity 40%  Temperature 21C  Humidity 40%",
+    "Happy Birthday Alex! Happy Birthday Alex! Happy Birthday Alex!",
+    "Now serving: A102 - Counter 3 *** Now serving: A103 - Counter 1 *** Now serving: A104 - Counter 2",
+    "Lot A: FULL   Lot B: 12 free   Lot C: 48 free   Lot D: FULL",
+    "Game day! Home 3 - 2 Away  *  Game day! Home 3 - 2 Away  *  Game day! Home 3 - 2 Away  *  "
+    "Game day! Home 3 - 2 Away  *  Game day! Home 3 - 2 Away  *  Game day! Home 3 - 2 Away  *  "
+    "Game day! Home 3 - 2 Away  *  Game day! Home 3 - 2 Away  *",
+};
+
+static uint32 Pdus(uint16 bytes)
+{
+    return (bytes + ATT_OVERHEAD + LL_PAYLOAD - 1) / LL_PAYLOAD;
+}
+
+int main(void)
+{
+    static LZ_STATE_T lz;
+    uint8 packed[MESSAGE_SIZE];
+    char check[LZ_MAX_LENGTH];
+    uint32 totalText = 0, totalPacked = 0, totalPdus = 0;
+    unsigned n, run;
+    uint16 i;
+    volatile char sink;
+    char raw[8];
+    
+    printf("%-6s %6s %6s %6s %9s %9s %12s\n",
+        "msg", "chars", "packed", "ratio", "PDUs raw", "PDUs lz", "ns/column");
+    
+    for (n = 0; n < sizeof(corpus) / sizeof(corpus[0]); n++)
+    {
+        uint16 length = (uint16)strlen(corpus[n]);
+        uint16 size = LzPack(corpus[n], length, packed, MESSAGE_SIZE - 2 - 2);
+        uint16 plainUpload = (length <= MESSAGE_SIZE) ? length : 0;
+        double t0, t1;
+        
+        if ((size == 0) || !LzValidate(packed, size, length))
+        {
+            printf("message %u: pack failed\n", n);
+            return 1;
+        }
+        
+        LzExpand(packed, check, length);
+        if (memcmp(check, corpus[n], length) != 0)
+        {
+            printf("message %u: LzExpand mismatch\n", n);
+            return 1;
+        }
+        LzStart(&lz, packed);
+        for (i = 0; i < length; i++)
+        {
+            if (LzNext(&lz) != corpus[n][i])
+            {
+                printf("message %u: LzNext mismatch at %u\n", n, i);
+                return 1;
+            }
+        }
+        
+        /* One LzNext per character, shared by its 8 columns, as in Display_ISR */
+        t0 = StubTime();
+        for (run = 0; run < RUNS; run++)
+        {
+            LzStart(&lz, packed);
+            for (i = 0; i < length; i++)
+            {
+                sink = LzNext(&lz);
+            }
+        }
+        t1 = StubTime();
+        (void)sink;
+        
+        /* Packed goes in a COMMAND record: 2 TLV + 2 length bytes */
+        if (plainUpload)
+        {
+            sprintf(raw, "%u", Pdus(plainUpload));
+        }
+        else
+        {
+            sprintf(raw, "n/a");
+        }
+        printf("%-6u %6u %6u %5.2fx %9s %9u %12.2f\n", n, length, size,
+            (double)length / (size + 4), raw, Pdus(size + 4),
+            (t1 - t0) * 1e9 / ((double)RUNS * length * 8));
+        
+        totalText += length;
+        totalPacked += size + 4;
+        if (plainUpload)
+        {
+            totalPdus += Pdus(plainUpload) - Pdus(size + 4);
+        }
+    }
+    
+    printf("\ntotal: %u chars in %u bytes, %.2fx\n", totalText, totalPacked, (double)totalText / totalPacked);
+    printf("upload: %u fewer link-layer PDUs for the messages that fit unpacked, ~%.1f ms of air time\n",
+        totalPdus, totalPdus * PDU_US / 1000.0);
+    printf("decoder RAM: %u bytes state, %u bytes packed store\n", (unsigned)sizeof(LZ_STATE_T), MESSAGE_SIZE);
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,79 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <lzpack.h>
+
+/* Reference packer for the client side: greedy longest match in the window */
+uint16 LzPack(const char *text, uint16 length, uint8 *out, uint16 max)
+{
+    uint16 i = 0;
+    uint16 o = 0;
+    uint16 flagPos = 0;
+    uint8 item = 8;
+    
+    while (i < length)
+    {
+        uint16 best = 0;
+        uint16 bestOffset = 0;
+        uint16 offset;
+        
+        if (item == 8)
+        {
+            if (o >= max)
+            {
+                return 0;
+            }
+            flagPos = o;
+            out[o++] = 0;
+            item = 0;
+        }
+        
+        for (offset = 1; (offset <= LZ_WINDOW) && (offset <= i); offset++)
+        {
+            uint16 n = 0;
+            
+            while (((i + n) < length) && (n < LZ_MAX_MATCH) && (text[i + n] == text[i + n - offset]))
+            {
+                n++;
+            }
+            if (n > best)
+            {
+                best = n;
+                bestOffset = offset;
+            }
+        }
+        
+        if (best >= LZ_MIN_MATCH)
+        {
+            if ((o + 2) > max)
+            {
+                return 0;
+            }
+            out[flagPos] |= (uint8)(1 << item);
+            out[o++] = (uint8)(((bestOffset - 1) & 0x7F) | (((best - LZ_MIN_MATCH) >> 1) & 0x80));
+            out[o++] = (uint8)(best - LZ_MIN_MATCH);
+            i += best;
+        }
+        else
+        {
+            if (o >= max)
+            {
+                return 0;
+            }
+            out[o++] = (uint8)text[i++];
+        }
+        item++;
+    }
+    
+    return o;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,22 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _LZPACK_H_
+#define _LZPACK_H_
+
+#include <Lz.h>
+
+/* Packs 'length' characters into the Lz.h stream format. Returns the packed
+* size, or 0 if it would not fit in 'max' bytes. */
+uint16 LzPack(const char *text, uint16 length, uint8 *out, uint16 max);
+
+#endif
+/* [] END OF FILE */
@@ -0,0 +1,169 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Checks OrientBlock and OrientDirty for every orientation against a pixel by
+* pixel reference, then times the word kernel against the reference, which
+* works out the source of every pixel as a straightforward commit would. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Orient.h>
+
+#define BLOCKS      4096
+#define ROUNDS      200
+
+static const char *names[MODULE_ORIENTS] =
+{
+    "0", "90", "180", "270", "0 mirror", "90 mirror", "180 mirror", "270 mirror"
+};
+
+static uint8 blocks[BLOCKS][8];     // pixel rows, MSB the leftmost pixel
+static volatile uint8 sink;
+
+/* The block pixel shown by bit 's' of digit 'd' of a module mounted 'orient' */
+static void Source(uint8 orient, uint8 d, uint8 s, uint8 *x, uint8 *y)
+{
+    switch (orient & 3)
+    {
+        case MODULE_ROT_0:   *x = d;     *y = s;     break;
+        case MODULE_ROT_90:  *x = 7 - s; *y = d;     break;
+        case MODULE_ROT_180: *x = 7 - d; *y = 7 - s; break;
+        default:             *x = s;     *y = 7 - d; break;
+    }
+    if (orient & MODULE_MIRROR)
+    {
+        *x = 7 - *x;
+    }
+}
+
+static void Reference(uint8 orient, const uint8 *rows, uint8 *digits)
+{
+    uint8 d, s, x, y;
+    
+    for (d = 0; d < 8; d++)
+    {
+        digits[d] = 0;
+        for (s = 0; s < 8; s++)
+        {
+            Source(orient, d, s, &x, &y);
+            if ((rows[y] >> (7 - x)) & 1)
+            {
+                digits[d] |= (1u << s);
+            }
+        }
+    }
+}
+
+static void Pack(const uint8 *rows, uint32 *top, uint32 *bottom)
+{
+    *top = ((uint32)rows[0] << 24) | ((uint32)rows[1] << 16) | ((uint32)rows[2] << 8) | rows[3];
+    *bottom = ((uint32)rows[4] << 24) | ((uint32)rows[5] << 16) | ((uint32)rows[6] << 8) | rows[7];
+}
+
+static int Check(uint8 orient)
+{
+    uint8 flags = OrientFlags(orient);
+    uint8 want[8], got[8];
+    uint32 top, bottom;
+    unsigned i, columns;
+    uint8 d, s, x, y, needed;
+    int errors = 0;
+    
+    for (i = 0; i < BLOCKS; i++)
+    {
+        Reference(orient, blocks[i], want);
+        Pack(blocks[i], &top, &bottom);
+        OrientBlock(flags, top, bottom, got);
+        for (d = 0; d < 8; d++)
+        {
+            errors += (got[d] != want[d]);
+        }
+    }
+    
+    /* A digit must be re-sent exactly when it shows one of the changed columns */
+    for (columns = 0; columns < 256; columns++)
+    {
+        needed = 0;
+        for (d = 0; d < 8; d++)
+        {
+            for (s = 0; s < 8; s++)
+            {
+                Source(orient, d, s, &x, &y);
+                if (columns & (1u << x))
+                {
+                    needed |= (1u << d);
+                }
+            }
+        }
+        errors += (OrientDirty(flags, (uint8)columns) != needed);
+    }
+    return errors;
+}
+
+int main(void)
+{
+    uint32 seed = 12345;
+    uint8 digits[8];
+    uint32 top, bottom;
+    unsigned i, r;
+    uint8 orient, flags, b;
+    int errors = 0, bad;
+    double t0, word, pixel;
+    
+    for (i = 0; i < BLOCKS; i++)
+    {
+        for (b = 0; b < 8; b++)
+        {
+            seed = (seed * 1103515245u) + 12345u;
+            blocks[i][b] = (uint8)(seed >> 16);
+        }
+    }
+    
+    printf("%-12s %8s %10s %12s %8s\n", "orientation", "check", "word ns", "pixel ns", "ratio");
+    for (orient = 0; orient < MODULE_ORIENTS; orient++)
+    {
+        flags = OrientFlags(orient);
+        bad = Check(orient);
+        errors += bad;
+        
+        t0 = StubTime();
+        for (r = 0; r < ROUNDS; r++)
+        {
+            for (i = 0; i < BLOCKS; i++)
+            {
+                Pack(blocks[i], &top, &bottom);
+                OrientBlock(flags, top, bottom, digits);
+                sink ^= digits[i % 8];
+            }
+        }
+        word = (StubTime() - t0) * 1e9 / (ROUNDS * BLOCKS);
+        
+        t0 = StubTime();
+        for (r = 0; r < ROUNDS; r++)
+        {
+            for (i = 0; i < BLOCKS; i++)
+            {
+                Reference(orient, blocks[i], digits);
+                sink ^= digits[i % 8];
+            }
+        }
+        pixel = (StubTime() - t0) * 1e9 / (ROUNDS * BLOCKS);
+        
+        printf("%-12s %8s %10.1f %12.1f %7.1fx\n", names[orient], bad ? "WRONG" : "ok", word, pixel, pixel / word);
+    }
+    
+    if (errors)
+    {
+        printf("\nFAIL: %d digits did not match the reference\n", errors);
+    }
+    return errors != 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* A notice shown a page at a time against the same text scrolled across,
+* on a wall two module rows tall built with the geometry given by the
+* Makefile. Checks that the wrapped lines fit the panel and give back the
+* message word for word, then counts the ticks each takes to present the
+* whole message and measures the host time and MAX7219 packets of a tick.
+* A page that is held sends nothing, so only the ticks that move cost
+* packets. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Zone.h>
+#include <Framebuffer.h>
+#include <Page.h>
+
+#define RATE        30      // ticks a second, a column or a pixel row each
+#define HOLD        20      // tenths of a second each page is held
+#define PASSES      200
+
+static const char notice[] =
+    "Platform 4: the 17:42 to Leeds is delayed by about 12 minutes. "
+    "Please stand behind the yellow line and mind the gap when boarding. "
+    "Thank you for your patience.";
+
+/* Wraps the notice a line at a time, checking each line fits and that the
+* lines joined again, with a space where one was broken at, are the notice.
+* Returns the lines. */
+static unsigned Lines(int *errors)
+{
+    static char joined[sizeof(notice)];
+    uint16 length = sizeof(notice) - 1;
+    uint16 start = 0, end, next, width;
+    unsigned lines = 0;
+    size_t used = 0;
+    
+    while (start < length)
+    {
+        end = PageWrap(notice, length, start, &next, &width);
+        *errors += (width > FB_WIDTH) || (next <= start);
+        memcpy(&joined[used], &notice[start], end - start);
+        used += end - start;
+        if ((end < length) && (notice[end] == ' '))
+        {
+            joined[used++] = ' ';
+        }
+        lines++;
+        for (start = next; (start < length) && (notice[start] == ' '); start++)
+        {
+        }
+    }
+    joined[used] = 0;
+    *errors += (strcmp(joined, notice) != 0);
+    return lines;
+}
+
+int main(void)
+{
+    TEXT_DESC_T text = { notice, sizeof(notice) - 1, TEXT_SOURCE_RAM };
+    const RENDER_T *r = &zones[0].render;
+    unsigned lines, pages, paged, scrolled, moving, n;
+    uint32 packets[2];
+    double t0, tick[2];
+    int errors = 0;
+    
+    stubTickRate = RATE;
+    FramebufferInit();
+    ZoneInit();
+    
+    lines = Lines(&errors);
+    pages = (lines + PAGE_LINES - 1) / PAGE_LINES;
+    
+    /* Paged: each page comes in a row a tick, then holds; the message has
+    * been presented once the last page has been held */
+    moving = pages * FB_HEIGHT;
+    paged = moving + (pages * ((HOLD * RATE) / 10));
+    
+    /* Scrolled: the message has been presented once its last column has
+    * crossed the panel */
+    ZoneStart(0, &text);
+    scrolled = r->columns + r->width;
+    
+    /* Host time and packets of a tick while a page comes in, and of a
+    * scroll step */
+    PageStart(&text, HOLD);
+    StubReset();
+    t0 = StubTime();
+    for (n = 0; n < PASSES * FB_HEIGHT; n++)
+    {
+        if ((n % FB_HEIGHT) == 0)
+        {
+            PageRefresh();
+        }
+        PageTick();
+        FramebufferCommit();
+    }
+    tick[0] = (StubTime() - t0) * 1e9 / n;
+    packets[0] = stubPackets;
+    
+    ZoneStart(0, &text);
+    StubReset();
+    t0 = StubTime();
+    for (n = 0; n < PASSES * FB_HEIGHT; n++)
+    {
+        ZoneTick();
+        FramebufferCommit();
+    }
+    tick[1] = (StubTime() - t0) * 1e9 / n;
+    packets[1] = stubPackets;
+    
+    printf("%u x %u modules, %u ticks/s, %u byte message in %u lines, %u a page\n\n", PANEL_COLUMNS,
+        PANEL_ROWS, RATE, (unsigned)text.length, lines, PAGE_LINES);
+    printf("%-10s %8s %10s %10s %12s %12s %10s %8s\n", "", "ticks", "moving", "seconds", "ns/tick",
+        "packets/tick", "packets", "wrap");
+    printf("%-10s %8u %10u %10.1f %12.1f %12.1f %10.0f %8s\n", "paged", paged, moving, (double)paged / RATE,
+        tick[0], (double)packets[0] / n, (double)packets[0] * moving / n, errors ? "WRONG" : "ok");
+    printf("%-10s %8u %10u %10.1f %12.1f %12.1f %10.0f\n", "scrolled", scrolled, scrolled,
+        (double)scrolled / RATE, tick[1], (double)packets[1] / n, (double)packets[1] * scrolled / n);
+    printf("\n%u pages held %.1f s each\n", pages, HOLD / 10.0);
+    
+    if (errors != 0)
+    {
+        printf("pages wrapped wrong\n");
+        return 1;
+    }
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,114 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Stand-in for the PSoC Creator project.h so the firmware modules that do not
+* touch hardware can be built and measured on the host. */
+#ifndef _HOST_PROJECT_H_
+#define _HOST_PROJECT_H_
+
+#include <stdint.h>
+#include <string.h>
+
+typedef uint8_t     uint8;
+typedef uint16_t    uint16;
+typedef uint32_t    uint32;
+typedef int8_t      int8;
+typedef int16_t     int16;
+typedef int32_t     int32;
+
+#define LO8(x)      ((uint8)((x) & 0xFFu))
+#define HI8(x)      ((uint8)((uint16)(x) >> 8))
+
+#define CY_ISR(name)    void name(void)
+#define CY_ALIGN(align) __attribute__ ((aligned(align)))
+#define CY_SECTION(name) __attribute__ ((section(name)))
+
+/* Values from CyFlash.h and BLE_StackGatt.h */
+#define CY_FLASH_SIZEOF_ROW     128u
+
+typedef enum
+{
+    CYBLE_GATT_ERR_NONE = 0x00u,
+    CYBLE_GATT_ERR_PREPARE_WRITE_QUEUE_FULL = 0x09u,
+    CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN = 0x0Du,
+    CYBLE_GATT_ERR_UNLIKELY_ERROR = 0x0Eu,
+    CYBLE_GATT_ERR_INSUFFICIENT_RESOURCE = 0x11u,
+    CYBLE_GATT_ERR_OUT_OF_RANGE = 0xFFu
+} CYBLE_GATT_ERR_CODE_T;
+
+/* Just enough of BLE_StackGattDb.h and the generated BLE_custom.h for the
+* modules that fill in an attribute before it is read */
+typedef struct
+{
+    uint8 *val;
+    uint16 len;
+    uint16 actualLen;
+} CYBLE_GATT_VALUE_T;
+
+typedef struct
+{
+    CYBLE_GATT_VALUE_T value;
+    uint16 attrHandle;
+} CYBLE_GATT_HANDLE_VALUE_PAIR_T;
+
+typedef struct
+{
+    uint8 bdHandle;
+    uint8 attId;
+} CYBLE_CONN_HANDLE_T;
+
+#define CYBLE_GATT_DB_LOCALLY_INITIATED         0x00u
+#define CYBLE_MESSAGE_CLOCK_CONTROL_CHAR_HANDLE 0x0021u
+
+typedef struct CYBLE_GATTS_WRITE_REQ_PARAM_T CYBLE_GATTS_WRITE_REQ_PARAM_T;
+
+extern CYBLE_CONN_HANDLE_T cyBle_connHandle;
+CYBLE_GATT_ERR_CODE_T CyBle_GattsWriteAttributeValue(CYBLE_GATT_HANDLE_VALUE_PAIR_T *handleValuePair,
+    uint16 offset, CYBLE_CONN_HANDLE_T *connHandle, uint8 flags);
+
+/* Values from CyLFClk.h */
+#define CY_SYS_WDT_MODE_INT         1u
+#define CY_SYS_WDT_COUNTER0         0x00u
+#define CY_SYS_WDT_COUNTER0_MASK    0x01u
+#define CY_SYS_WDT_COUNTER0_RESET   (0x01u << 3u)
+
+typedef void (*cyWdtCallback)(void);
+typedef void (*cyisraddress)(void);
+
+/* Values from the generated cyfitter.h and DisplayTimer.h */
+#define CYDEV_BCLK__HFCLK__HZ           48000000U
+#define DisplayTimer_TC_PERIOD_VALUE    (63999lu)
+
+/* Hardware used by the display modules, provided by stubs.c */
+void CS_Write(uint8 value);
+void CyDelayUs(uint32 us);
+uint32 MAX7219_SpiUartGetTxBufferSize(void);
+uint32 MAX7219_SpiIsBusBusy(void);
+void DisplayTimer_WritePeriod(uint32 period);
+void Timer_CLK_Stop(void);
+void Timer_CLK_Start(void);
+void Timer_CLK_SetDividerValue(uint16 clkDivider);
+void CySysWdtUnlock(void);
+void CySysWdtLock(void);
+void CySysWdtSetMode(uint32 counterNum, uint32 mode);
+void CySysWdtSetMatch(uint32 counterNum, uint32 match);
+void CySysWdtSetClearOnMatch(uint32 counterNum, uint32 enable);
+cyWdtCallback CySysWdtSetInterruptCallback(uint32 counterNum, cyWdtCallback function);
+void CySysWdtEnable(uint32 counterMask);
+void CySysWdtResetCounters(uint32 countersMask);
+void CySysWdtIsr(void);
+cyisraddress CyIntSetVector(uint8 number, cyisraddress address);
+void CyIntEnable(uint8 number);
+uint8 CyEnterCriticalSection(void);
+void CyExitCriticalSection(uint8 savedIntrStatus);
+
+#endif
+/* [] END OF FILE */
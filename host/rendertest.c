@@ -0,0 +1,1121 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Checks the markup compiler, the render executor, UTF-8 and proportional text,
+* the zone compositor, drawing and pages against the framebuffer they produce, with
+* the hardware replaced by stubs.c. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Zone.h>
+#include <Framebuffer.h>
+#include <font.h>
+#include <Glyph.h>
+#include <Sprite.h>
+#include <Draw.h>
+#include <Field.h>
+#include <Clock.h>
+#include <Schedule.h>
+#include <Command.h>
+#include <Var.h>
+#include <Page.h>
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+/* The columns of a byte straight from the built-in font, which is unpacked */
+#define FONT_GLYPH(c)   (&font.glyphs[(uint8)(c) * 8])
+
+static TEXT_DESC_T text;
+static RENDER_T *r = &zones[0].render;
+
+static void Start(const char *s)
+{
+    text.text = s;
+    text.length = (uint16)strlen(s);
+    text.source = TEXT_SOURCE_RAM;
+    FramebufferClear();
+    ZoneStart(0, &text);
+}
+
+static void Ticks(unsigned n)
+{
+    while (n--)
+    {
+        ZoneTick();
+        FramebufferCommit();
+    }
+}
+
+static uint8 ShowsGlyph(uint8 x, char c, uint8 invert)
+{
+    uint8 col;
+    
+    for (col = 0; col < 8; col++)
+    {
+        uint8 bits = GlyphColumns(GLYPH_RAW_BYTE | (uint8)c)[col];
+        if (FramebufferColumn(x + col) != (invert ? (uint8)~bits : bits))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static uint8 ShowsCode(uint8 x, uint16 code)
+{
+    uint8 col;
+    
+    for (col = 0; col < 8; col++)
+    {
+        if (FramebufferColumn(x + col) != GlyphColumns(code)[col])
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static uint8 Blank(uint8 x, uint8 n)
+{
+    while (n--)
+    {
+        if (FramebufferColumn(x++) != 0)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/* Proportional text from column x: each glyph's lit columns, then the spacing */
+static uint8 ShowsNarrow(uint8 x, const char *s)
+{
+    uint8 extent, col;
+    
+    for (; *s; s++)
+    {
+        extent = GlyphExtent(GLYPH_RAW_BYTE | (uint8)*s);
+        for (col = 0; col < FONT_EXTENT_WIDTH(extent); col++)
+        {
+            if (FramebufferColumn(x++) != GlyphColumns(GLYPH_RAW_BYTE | (uint8)*s)[FONT_EXTENT_FIRST(extent) + col])
+            {
+                return FALSE;
+            }
+        }
+        if ((s[1] != 0) && !Blank(x, r->spacing))
+        {
+            return FALSE;
+        }
+        x += r->spacing;
+    }
+    return TRUE;
+}
+
+static void TestCompile(void)
+{
+    Start("PSoC");
+    CHECK(r->opCount == 2);
+    CHECK(r->program[0].op == RENDER_OP_TEXT && r->program[0].start == 0 && r->program[0].length == 4);
+    CHECK(r->program[1].op == RENDER_OP_END);
+    
+    Start("<c>OK<p20>Hi<s50>there");
+    CHECK(r->opCount == 6);
+    CHECK(r->program[0].op == RENDER_OP_STATIC && r->program[0].start == 3 && r->program[0].length == 2);
+    CHECK((r->program[0].arg & RENDER_ALIGN_MASK) == RENDER_ALIGN_CENTER);
+    CHECK(r->program[1].op == RENDER_OP_PAUSE && r->program[1].arg == 20);
+    CHECK(r->program[2].op == RENDER_OP_TEXT && r->program[2].length == 2);
+    CHECK(r->program[3].op == RENDER_OP_SPEED && r->program[3].arg == 50);
+    CHECK(r->program[4].op == RENDER_OP_TEXT && r->program[4].length == 5);
+    
+    Start("<b>A</b>B<i>C");
+    CHECK(r->opCount == 4);
+    CHECK(r->program[0].arg == RENDER_ATTR_BLINK);
+    CHECK(r->program[1].arg == 0);
+    CHECK(r->program[2].arg == RENDER_ATTR_INVERSE);
+    
+    Start("a<<b");
+    CHECK(r->opCount == 3);
+    CHECK(r->program[0].length == 2 && r->program[1].start == 3);
+    
+    /* Not tags: shown as typed */
+    Start("<x> <p> <b5> <p300> <");
+    CHECK(r->opCount == 2 && r->program[0].length == text.length);
+    
+    /* Too long to align: scrolls instead */
+    Start("<r>ABC");
+    CHECK(r->program[0].op == RENDER_OP_TEXT);
+    
+    /* More ops than fit: shown as typed */
+    Start("<b>1</b><b>2</b><b>3</b><b>4</b><b>5</b><b>6</b><b>7</b><b>8</b><b>9</b>"
+        "<b>1</b><b>2</b><b>3</b><b>4</b><b>5</b><b>6</b><b>7</b><b>8</b><b>9</b>"
+        "<b>1</b><b>2</b><b>3</b><b>4</b><b>5</b><b>6</b><b>7</b><b>8</b><b>9</b>"
+        "<b>1</b><b>2</b><b>3</b><b>4</b><b>5</b><b>6</b><b>7</b><b>8</b><b>9</b>");
+    CHECK(r->opCount == 2 && r->program[0].length == text.length);
+}
+
+static void TestScroll(void)
+{
+    stubTickRate = 1000;    // keep blinking out of the way
+    Start("AB");
+    Ticks(FB_COLUMNS);
+    CHECK(ShowsGlyph(0, 'A', FALSE) && ShowsGlyph(8, 'B', FALSE));
+    Ticks(FB_COLUMNS);
+    CHECK(Blank(0, FB_COLUMNS));
+    Ticks(8);
+    CHECK(ShowsGlyph(FB_COLUMNS - 8, 'A', FALSE));
+    
+    Start("<i>A");
+    Ticks(8);
+    CHECK(ShowsGlyph(FB_COLUMNS - 8, 'A', TRUE));
+}
+
+static void TestControl(void)
+{
+    stubTickRate = 1000;
+    Start("<c>A<p1>B");
+    Ticks(1);
+    CHECK(Blank(0, (FB_COLUMNS - 8) / 2) && ShowsGlyph((FB_COLUMNS - 8) / 2, 'A', FALSE));
+    Ticks(100);
+    CHECK(ShowsGlyph((FB_COLUMNS - 8) / 2, 'A', FALSE));
+    Ticks(1);
+    CHECK(!ShowsGlyph((FB_COLUMNS - 8) / 2, 'A', FALSE));
+    
+    Start("A<s20>B");
+    Ticks(8);
+    CHECK(r->divider == r->baseDivider);
+    Ticks(1);
+    CHECK(r->divider == (255 - 20));
+    Ticks(7 + FB_COLUMNS);
+    CHECK(r->divider == r->baseDivider);
+}
+
+static void TestBlink(void)
+{
+    /* Half a second on, half a second off */
+    stubTickRate = 20;
+    Start("<c><b>A</b><p50>");
+    Ticks(10);
+    CHECK(ShowsGlyph((FB_COLUMNS - 8) / 2, 'A', FALSE));
+    Ticks(1);
+    CHECK(Blank(0, FB_COLUMNS));
+    Ticks(10);
+    CHECK(Blank(0, FB_COLUMNS));
+    Ticks(1);
+    CHECK(ShowsGlyph((FB_COLUMNS - 8) / 2, 'A', FALSE));
+}
+
+static void TestSplice(void)
+{
+    static char buffer[32] = "ABCDEFGH";
+    
+    stubTickRate = 1000;
+    text.text = buffer;
+    text.length = 8;
+    text.source = TEXT_SOURCE_RAM;
+    FramebufferClear();
+    ZoneStart(0, &text);
+    Ticks(6 * 8);                           // panel shows E F
+    CHECK(ShowsGlyph(0, 'E', FALSE) && ShowsGlyph(8, 'F', FALSE));
+    
+    /* Insert "xy" at 1, behind the window: still E F */
+    memmove(&buffer[3], &buffer[1], 7);
+    memcpy(&buffer[1], "xy", 2);
+    text.length = 10;
+    StubReset();
+    RenderSplice(r, &text, 1, 2);
+    FramebufferCommit();
+    CHECK(ShowsGlyph(0, 'E', FALSE) && ShowsGlyph(8, 'F', FALSE));
+    CHECK(stubPackets == 0);
+    Ticks(8);
+    CHECK(ShowsGlyph(0, 'F', FALSE) && ShowsGlyph(8, 'G', FALSE));
+}
+
+static void TestUtf8(void)
+{
+    static char buffer[32] = "\xC3\x84" "BCDEFGH";     // "ÄBCDEFGH"
+    uint8 size;
+    
+    CHECK(Utf8Decode((const uint8 *)"\xE2\x82\xAC", 3, &size) == 0x20AC && size == 3);
+    CHECK(Utf8Decode((const uint8 *)"\xE2\x82", 2, &size) == 0 && size == 0);
+    CHECK(Utf8Decode((const uint8 *)"\xC0\xAF", 2, &size) == (GLYPH_RAW_BYTE | 0xC0) && size == 1);
+    CHECK(Utf8Decode((const uint8 *)"\xED\xA0\x80", 3, &size) == (GLYPH_RAW_BYTE | 0xED) && size == 1);
+    CHECK(Utf8Decode((const uint8 *)"\xF0\x9F\x98\x80", 4, &size) == GLYPH_UNKNOWN && size == 4);
+    CHECK(Utf8Count("a\xC3\xA9\xE2\x82\xAC\x82", 7) == 4);
+    CHECK(Utf8Trim("ab\xC3", 3) == 2 && Utf8Trim("ab\xC3\xA9", 4) == 4 && Utf8Trim("\xE2\x82", 2) == 0);
+    
+    /* The store: CP437 glyphs by code point, composed letters, the rest */
+    CHECK(memcmp(GlyphColumns(0x00E9), FONT_GLYPH(0x82), 8) == 0);     // é
+    CHECK(memcmp(GlyphColumns(0x0410), FONT_GLYPH('A'), 8) == 0);      // Cyrillic А
+    CHECK(memcmp(GlyphColumns(0x0105), FONT_GLYPH('a'), 8) != 0);      // ą
+    CHECK(memcmp(GlyphColumns(0x4E2D), FONT_GLYPH(GLYPH_MISSING), 8) == 0);
+    CHECK(memcmp(GlyphColumns(GLYPH_RAW_BYTE | 0x82), FONT_GLYPH(0x82), 8) == 0);
+    
+    /* A character is eight columns whatever its bytes, and markup counts characters */
+    stubTickRate = 1000;
+    Start("\xC3\xA9\xE2\x82\xAC");                     // "é€"
+    CHECK(r->program[0].length == 2);
+    Ticks(FB_COLUMNS);
+    CHECK(ShowsGlyph(0, (char)0x82, FALSE) && ShowsCode(8, 0x20AC));
+    Start("\x82" "A");                                 // CP437 bytes still show as before
+    Ticks(FB_COLUMNS);
+    CHECK(ShowsGlyph(0, (char)0x82, FALSE) && ShowsGlyph(8, 'A', FALSE));
+    Start("\xC5\xBE<c>\xD0\xAF");                     // "ž<c>Я"
+    CHECK(r->program[0].length == 1 && r->program[1].op == RENDER_OP_STATIC);
+    CHECK(r->program[1].start == 4 && r->program[1].length == 1);
+    
+    /* An edit behind the window, in bytes, keeps the same characters in view */
+    text.text = buffer;
+    text.length = 9;
+    text.source = TEXT_SOURCE_RAM;
+    FramebufferClear();
+    ZoneStart(0, &text);
+    Ticks(6 * 8);                           // panel shows E F
+    CHECK(ShowsGlyph(0, 'E', FALSE) && ShowsGlyph(8, 'F', FALSE));
+    memmove(&buffer[4], &buffer[2], 7);
+    memcpy(&buffer[2], "\xC3\xB1", 2);       // "ñ" after the Ä
+    text.length = 11;
+    RenderSplice(r, &text, 2, 2);
+    FramebufferCommit();
+    CHECK(ShowsGlyph(0, 'E', FALSE) && ShowsGlyph(8, 'F', FALSE));
+    Ticks(8);
+    CHECK(ShowsGlyph(0, 'F', FALSE) && ShowsGlyph(8, 'G', FALSE));
+}
+
+static void TestEffects(void)
+{
+    stubTickRate = 1000;
+    Start("AB");
+    Ticks(FB_COLUMNS);
+    
+    /* Wipe: one more column of the new text each frame */
+    ZoneEffect(0, EFFECT_WIPE);
+    text.text = "<l>CD<p50>";
+    text.length = 10;
+    ZoneStart(0, &text);
+    Ticks(1);
+    CHECK(FramebufferColumn(0) == GlyphColumns('C')[0]);
+    CHECK(ShowsGlyph(8, 'B', FALSE));
+    Ticks(FB_COLUMNS - 1);
+    CHECK(!zones[0].effect.active && ShowsGlyph(0, 'C', FALSE) && ShowsGlyph(8, 'D', FALSE));
+    
+    /* Vertical scroll: gone after eight frames */
+    ZoneEffect(0, EFFECT_VSCROLL);
+    text.text = "<l>EF<p50>";
+    ZoneStart(0, &text);
+    Ticks(4);
+    CHECK(zones[0].effect.active && !ShowsGlyph(0, 'E', FALSE));
+    Ticks(4);
+    CHECK(!zones[0].effect.active && ShowsGlyph(0, 'E', FALSE));
+    
+    /* Fade: out, blank swap frame, back in */
+    fbBrightness = 15;
+    ZoneEffect(0, EFFECT_FADE);
+    text.text = "<l>GH<p50>";
+    ZoneStart(0, &text);
+    Ticks(16);
+    CHECK(Blank(0, FB_COLUMNS));
+    Ticks(16);
+    CHECK(!zones[0].effect.active && ShowsGlyph(0, 'G', FALSE));
+    
+    ZoneEffect(0, EFFECT_SCROLL);
+    CHECK(!zones[0].effect.active);
+}
+
+static void TestProportional(void)
+{
+    static char buffer[32] = "ABCDEFGH";
+    uint8 expected[FB_COLUMNS];
+    uint8 x;
+    
+    stubTickRate = 1000;
+    ZoneSpacing(0, RENDER_SPACING);
+    
+    /* Narrow glyphs take fewer columns; fixed cells take eight each */
+    Start("il");
+    CHECK(r->columns == (FONT_EXTENT_WIDTH(GlyphExtent('i')) + FONT_EXTENT_WIDTH(GlyphExtent('l')) + 2));
+    Start("Hi.");
+    Ticks(r->columns);
+    CHECK(ShowsNarrow(FB_COLUMNS - r->columns, "Hi."));
+    Start(" ");
+    CHECK(r->columns == FONT_SPACE_WIDTH + RENDER_SPACING);
+    
+    /* Still runs are measured without the spacing after them, so more fit */
+    Start("<c>ill<p50>");
+    CHECK(r->program[0].op == RENDER_OP_STATIC);
+    x = (FB_COLUMNS - (FONT_EXTENT_WIDTH(GlyphExtent('i')) + (2 * FONT_EXTENT_WIDTH(GlyphExtent('l'))) +
+        (2 * RENDER_SPACING))) / 2;
+    Ticks(1);
+    CHECK(Blank(0, x) && ShowsNarrow(x, "ill"));
+    
+    /* An edit behind the window moves the scroll by the columns it added */
+    text.text = buffer;
+    text.length = 8;
+    text.source = TEXT_SOURCE_RAM;
+    FramebufferClear();
+    ZoneStart(0, &text);
+    Ticks(30);
+    memmove(&buffer[3], &buffer[1], 7);
+    memcpy(&buffer[1], "ii", 2);
+    text.length = 10;
+    RenderSplice(r, &text, 1, 2);
+    Ticks(1);
+    for (x = 0; x < FB_COLUMNS; x++)
+    {
+        expected[x] = FramebufferColumn(x);
+    }
+    Start(buffer);
+    Ticks(30 + (2 * (FONT_EXTENT_WIDTH(GlyphExtent('i')) + RENDER_SPACING)) + 1);
+    for (x = 0; x < FB_COLUMNS; x++)
+    {
+        CHECK(FramebufferColumn(x) == expected[x]);
+    }
+    
+    ZoneSpacing(0, 0);
+    Start("AB");
+    CHECK(r->columns == (FONT_EXTENT_WIDTH(GlyphExtent('A')) + FONT_EXTENT_WIDTH(GlyphExtent('B'))));
+    ZoneSpacing(0, RENDER_FIXED);
+    Start("AB");
+    CHECK(r->columns == 16);
+}
+
+static void TestSprite(void)
+{
+    uint8 sprite[SPRITE_HEADER + 12];
+    uint8 width = 0;
+    uint16 crc;
+    uint8 x;
+    
+    sprite[0] = 2;
+    sprite[1] = 12;
+    for (x = 0; x < 12; x++)
+    {
+        sprite[SPRITE_HEADER + x] = (uint8)(0x81 | (1u << (x % 8)));
+    }
+    crc = SpriteChecksum(sprite);
+    sprite[2] = LO8(crc);
+    sprite[3] = HI8(crc ^ 0x0100);
+    CHECK(SpriteWrite(sprite, sizeof(sprite)) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    sprite[3] = HI8(crc);
+    CHECK(SpriteWrite(sprite, sizeof(sprite) - 1) == CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN);
+    CHECK(stubFlashRows == 0 && !spritesChanged);
+    stubFlashBusy = TRUE;
+    CHECK(SpriteWrite(sprite, sizeof(sprite)) == GATT_ERR_BUSY);
+    stubFlashBusy = FALSE;
+    CHECK(SpriteWrite(sprite, sizeof(sprite)) == CYBLE_GATT_ERR_NONE);
+    CHECK(stubFlashRows == 2 && spritesChanged);
+    
+    /* Kept over a reset, and only the slot that was written */
+    SpriteInit();
+    CHECK(SpriteColumns(SPRITE_CODE(2), &width) != NULL && width == 12);
+    CHECK(SpriteColumns(SPRITE_CODE(3), &width) == NULL && SpriteColumns('A', &width) == NULL);
+    
+    /* A sprite is a character as wide as it is, untrimmed */
+    ZoneSpacing(0, RENDER_SPACING);
+    Start("A\xEE\x80\x82" "B");
+    CHECK(r->columns == (FONT_EXTENT_WIDTH(GlyphExtent('A')) + 12 + FONT_EXTENT_WIDTH(GlyphExtent('B')) + 3));
+    Start("<l>\xEE\x80\x82");
+    Ticks(1);
+    for (x = 0; x < 12; x++)
+    {
+        CHECK(FramebufferColumn(x) == sprite[SPRITE_HEADER + x]);
+    }
+    CHECK(Blank(12, FB_COLUMNS - 12));
+    ZoneSpacing(0, RENDER_FIXED);
+    Start("\xEE\x80\x82");
+    CHECK(r->columns == 16);
+    
+    /* One that was never uploaded is the missing glyph; width 0 deletes */
+    Start("<l>\xEE\x80\x83");
+    Ticks(1);
+    CHECK(ShowsGlyph(0, GLYPH_MISSING, FALSE));
+    sprite[1] = 0;
+    crc = SpriteChecksum(sprite);
+    sprite[2] = LO8(crc);
+    sprite[3] = HI8(crc);
+    CHECK(SpriteWrite(sprite, SPRITE_HEADER) == CYBLE_GATT_ERR_NONE);
+    CHECK(SpriteColumns(SPRITE_CODE(2), &width) == NULL);
+}
+
+static void TestZones(void)
+{
+    static const uint8 split[ZONE_COUNT] = { 1, 1 };
+    static const uint8 whole[ZONE_COUNT] = { MODULE_COUNT, 0 };
+    static const uint8 noZero[ZONE_COUNT] = { 0, MODULE_COUNT };
+    static const uint8 tooWide[ZONE_COUNT] = { MODULE_COUNT, 1 };
+    uint8 quiet = 0;
+    uint8 i;
+    
+    CHECK(ZoneLayoutValid(split) && ZoneLayoutValid(whole));
+    CHECK(!ZoneLayoutValid(noZero) && !ZoneLayoutValid(tooWide));
+    
+    /* A still label in zone 0 beside text scrolling at half the speed */
+    stubTickRate = 1000;
+    Start("<l>A");
+    ZoneLayout(split);
+    ZoneSpeed(1, 144);                      // divider 111: a step every second tick
+    ZoneMessage(1, "BC", 2);
+    CHECK(ZoneDivider() == (255 - 200));
+    Ticks(16);
+    CHECK(ShowsGlyph(0, 'A', FALSE) && ShowsGlyph(8, 'B', FALSE));
+    
+    /* The label is not composited again: ticks without a zone 1 step send nothing */
+    for (i = 0; i < 8; i++)
+    {
+        StubReset();
+        Ticks(1);
+        quiet += (stubPackets == 0);
+    }
+    CHECK(quiet == 4);
+    CHECK(ShowsGlyph(0, 'A', FALSE) && !ShowsGlyph(8, 'B', FALSE));
+    
+    /* Zone 1's fade dims only its own module */
+    fbBrightness = 15;
+    ZoneEffect(1, EFFECT_FADE);
+    ZoneMessage(1, "D", 1);
+    Ticks(4);                               // two zone 1 steps
+    CHECK(zones[1].effect.active && !zones[0].effect.active);
+    CHECK(stubIntensity[0] == 15 && stubIntensity[1] < 15);
+    
+    ZoneEffect(1, EFFECT_SCROLL);
+    ZoneSpeed(1, 200);
+    ZoneLayout(whole);
+    Ticks(1);
+    CHECK(ShowsGlyph(0, 'A', FALSE));
+}
+
+/* What the panel should show, a byte per pixel, drawn a pixel at a time */
+static uint8 model[FB_HEIGHT][FB_WIDTH];
+
+static void ModelRect(int x, int y, int w, int h, uint8 colour)
+{
+    int i, j;
+    
+    for (j = y; j < (y + h); j++)
+    {
+        for (i = x; i < (x + w); i++)
+        {
+            if ((i >= 0) && (i < FB_WIDTH) && (j >= 0) && (j < FB_HEIGHT))
+            {
+                model[j][i] = (colour == DRAW_INVERT) ? !model[j][i] : colour;
+            }
+        }
+    }
+}
+
+static uint8 ShowsModel(void)
+{
+    uint16 x, y;
+    
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        for (x = 0; x < FB_WIDTH; x++)
+        {
+            if (((FramebufferColumn(((y / 8) * FB_WIDTH) + x) >> (y % 8)) & 1u) != model[y][x])
+            {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+/* What Display_ISR does on its next tick in draw mode */
+static void DrawTick(void)
+{
+    FramebufferCommit();
+}
+
+static void TestDraw(void)
+{
+    /* FILL, RECT partly off the left, HLINE past the right, VLINE inverting
+    * across both, a clipped transparent blit and text off the left edge */
+    static const uint8 ops[] =
+    {
+        DRAW_OP_FILL, DRAW_CLEAR,
+        DRAW_OP_RECT, 0xFD, 0xFF, 2, 8, 3, DRAW_SET,
+        DRAW_OP_HLINE, 5, 0, 0, 20, DRAW_SET,
+        DRAW_OP_VLINE, 3, 0, 0xFE, 6, DRAW_INVERT,
+        DRAW_OP_BLIT, 12, 0, 5, 10, 2, DRAW_BLIT_TRANSPARENT, 0xA5, 0x40, 0xFF, 0xC0,
+    };
+    static const uint8 text[] = { DRAW_OP_TEXT, 0xFE, 0xFF, 0, DRAW_SET, 2, 'H', 'i' };
+    static const uint8 pixel[] = { DRAW_OP_PIXEL, 3, 0, 4, DRAW_SET };
+    static const uint8 badOp[] = { DRAW_OP_CLOCK + 1, 0 };
+    static const uint8 shortBlit[] = { DRAW_OP_BLIT, 0, 0, 0, 8, 2, DRAW_BLIT_OPAQUE, 0xFF };
+    static const uint8 badColour[] = { DRAW_OP_PIXEL, 0, 0, 0, DRAW_COPY };
+    static const uint8 blit[2][2] = { { 0xA5, 0x40 }, { 0xFF, 0xC0 } };
+    const uint8 *columns;
+    uint8 extent;
+    int x, y, i, c;
+    
+    memset(model, 0, sizeof(model));
+    ModelRect(-3, 2, 8, 3, DRAW_SET);
+    ModelRect(5, 0, 20, 1, DRAW_SET);
+    ModelRect(3, -2, 1, 6, DRAW_INVERT);
+    for (y = 0; y < 2; y++)
+    {
+        for (x = 0; x < 10; x++)
+        {
+            if (blit[y][x / 8] & (0x80 >> (x % 8)))
+            {
+                ModelRect(12 + x, 5 + y, 1, 1, DRAW_SET);
+            }
+        }
+    }
+    CHECK(DrawWrite(ops, sizeof(ops)) == CYBLE_GATT_ERR_NONE);
+    CHECK(displayMode == DISPLAY_MODE_DRAW && ShowsModel());
+    
+    /* Only the lit pixels of the glyphs, the leftmost two columns clipped */
+    x = -2;
+    for (i = 0; i < 2; i++)
+    {
+        extent = GlyphExtent((uint8)"Hi"[i]);
+        columns = GlyphColumns((uint8)"Hi"[i]) + FONT_EXTENT_FIRST(extent);
+        for (c = 0; c < FONT_EXTENT_WIDTH(extent); c++)
+        {
+            for (y = 0; y < 8; y++)
+            {
+                if (columns[c] & (1u << y))
+                {
+                    ModelRect(x + c, y, 1, 1, DRAW_SET);
+                }
+            }
+        }
+        x += FONT_EXTENT_WIDTH(extent) + DRAW_TEXT_SPACING;
+    }
+    CHECK(DrawText(-2, 0, "Hi", 2, DRAW_SET) == x);
+    FramebufferCommit();
+    CHECK(ShowsModel());
+    CHECK(DrawWrite(text, sizeof(text)) == CYBLE_GATT_ERR_NONE && ShowsModel());
+    
+    /* A pixel already lit changes nothing and sends nothing */
+    model[4][3] = 1;
+    DrawWrite(pixel, sizeof(pixel));
+    DrawTick();
+    StubReset();
+    CHECK(DrawWrite(pixel, sizeof(pixel)) == CYBLE_GATT_ERR_NONE);
+    DrawTick();
+    CHECK(stubPackets == 0);
+    
+    /* Nothing of a list with a bad operation is drawn */
+    CHECK(DrawWrite(badOp, sizeof(badOp)) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    CHECK(DrawWrite(badColour, sizeof(badColour)) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    CHECK(DrawWrite(shortBlit, sizeof(shortBlit)) == CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN);
+    CHECK(ShowsModel());
+    displayMode = DISPLAY_MODE_TEXT;
+}
+
+/* The columns of cell 'i' of a field at 'left' with cells of 'cell' columns
+* show 'c', centred, where they are on the panel */
+static uint8 ShowsCell(int16 left, uint8 i, uint8 cell, char c)
+{
+    uint8 extent = GlyphExtent(GLYPH_RAW_BYTE | (uint8)c);
+    const uint8 *columns = GlyphColumns(GLYPH_RAW_BYTE | (uint8)c) + FONT_EXTENT_FIRST(extent);
+    uint8 margin = (cell - FONT_EXTENT_WIDTH(extent)) / 2;
+    int16 column;
+    uint8 x, bits;
+    
+    for (x = 0; x < cell; x++)
+    {
+        column = left + (i * cell) + x;
+        if ((column < 0) || (column >= FB_WIDTH))
+        {
+            continue;
+        }
+        bits = ((x >= margin) && (x < (margin + FONT_EXTENT_WIDTH(extent)))) ? columns[x - margin] : 0;
+        if (FramebufferColumn(column) != bits)
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void TestField(void)
+{
+    static const uint8 layout[] =
+    {
+        DRAW_OP_FILL, DRAW_SET,
+        DRAW_OP_FIELD, 0, 0, 0, 1, 3, 5, FIELD_RIGHT,
+        DRAW_OP_VALUE, 1, 2, '1', '2',
+    };
+    static const uint8 next[] = { DRAW_OP_VALUE, 1, 2, '1', '3' };
+    static const uint8 badField[] = { DRAW_OP_FIELD, 0, 0, 0, FIELD_COUNT, 3, 5, 0 };
+    static const uint8 badCell[] = { DRAW_OP_FIELD, 0, 0, 0, 1, 3, FIELD_MAX_CELL + 1, 0 };
+    static const uint8 badValue[] = { DRAW_OP_VALUE, FIELD_COUNT, 1, '1' };
+    
+    /* A number padded on the left over a cleared field, the rest still lit */
+    CHECK(DrawWrite(layout, sizeof(layout)) == CYBLE_GATT_ERR_NONE);
+    DrawTick();
+    CHECK(ShowsCell(0, 0, 5, ' ') && ShowsCell(0, 1, 5, '1') && ShowsCell(0, 2, 5, '2'));
+    CHECK(FramebufferColumn(15) == 0xFF);
+    
+    /* One character changes: only the digits of its cell are sent */
+    StubReset();
+    CHECK(DrawWrite(next, sizeof(next)) == CYBLE_GATT_ERR_NONE);
+    DrawTick();
+    CHECK(ShowsCell(0, 1, 5, '1') && ShowsCell(0, 2, 5, '3'));
+    CHECK((stubLatches > 0) && (stubLatches <= 5));
+    StubReset();
+    DrawWrite(next, sizeof(next));
+    DrawTick();
+    CHECK(stubPackets == 0);
+    
+    CHECK(DrawWrite(badField, sizeof(badField)) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    CHECK(DrawWrite(badCell, sizeof(badCell)) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    CHECK(DrawWrite(badValue, sizeof(badValue)) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    displayMode = DISPLAY_MODE_TEXT;
+}
+
+/* 'kind' formatted now is 'want' */
+static uint8 Formats(uint8 kind, const char *want)
+{
+    char text[CLOCK_TEXT_SIZE];
+    uint8 length = ClockFormat(kind, text);
+    
+    return (length == strlen(want)) && (memcmp(text, want, length) == 0);
+}
+
+static uint8 SetClock(uint32 now, uint32 end)
+{
+    uint8 data[CLOCK_SIZE];
+    uint8 i;
+    
+    for (i = 0; i < 4; i++)
+    {
+        data[i] = (uint8)(now >> (8 * i));
+        data[4 + i] = (uint8)(end >> (8 * i));
+    }
+    return ClockWrite(data, CLOCK_SIZE) == CYBLE_GATT_ERR_NONE;
+}
+
+static void TestClock(void)
+{
+    static const uint32 now = 1792316518u;  // 2026-10-18 09:41:58
+    static const uint8 time[3] = { 0 };
+    /* The last two cells of each on the panel: the minutes, and the seconds */
+    static const uint8 layout[] =
+    {
+        DRAW_OP_FILL, DRAW_CLEAR,
+        DRAW_OP_FIELD, (uint8)-14, 0xFF, 0, 0, 5, 6, 0,
+        DRAW_OP_CLOCK, 0, CLOCK_HHMM,
+    };
+    static const uint8 seconds[] =
+    {
+        DRAW_OP_FIELD, (uint8)-32, 0xFF, 0, 1, 8, 6, 0,
+        DRAW_OP_CLOCK, 1, CLOCK_HHMMSS,
+    };
+    static const uint8 badKind[] = { DRAW_OP_CLOCK, 0, CLOCK_KINDS };
+    
+    ClockInit();
+    CHECK(Formats(CLOCK_HHMM, "--:--"));
+    CHECK(ClockWrite(time, sizeof(time)) == CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN);
+    
+    CHECK(SetClock(now, now + (3 * 86400u) + (2 * 3600u) + (14 * 60u) + 59u));
+    CHECK(Formats(CLOCK_HHMM, "09:41") && Formats(CLOCK_HHMMSS, "09:41:58"));
+    CHECK(Formats(CLOCK_DATE, "18.10.26") && Formats(CLOCK_COUNTDOWN, "3d 02:14"));
+    StubSecond();
+    CHECK(Formats(CLOCK_HHMMSS, "09:41:59"));
+    ClockSyncAttribute();
+    CHECK((stubAttribute[0] == (uint8)(now + 1)) && (stubAttribute[3] == (uint8)(now >> 24)));
+    CHECK(SetClock(1709251199u, 1709251199u + 8099u));  // 2024-02-29 23:59:59
+    CHECK(Formats(CLOCK_DATE, "29.02.24") && Formats(CLOCK_COUNTDOWN, "02:14:59"));
+    StubSecond();
+    CHECK(Formats(CLOCK_DATE, "01.03.24") && Formats(CLOCK_HHMMSS, "00:00:00"));
+    CHECK(SetClock(4107542399u, 1));    // 2100 is not a leap year
+    CHECK(Formats(CLOCK_DATE, "28.02.00") && Formats(CLOCK_COUNTDOWN, "00:00:00"));
+    CHECK(SetClock(now, now + (12 * 86400u) + (2 * 3600u) + (14 * 60u)));
+    CHECK(Formats(CLOCK_COUNTDOWN, "12d02:14"));
+    CHECK(SetClock(now, now + (250 * 86400u)));
+    CHECK(Formats(CLOCK_COUNTDOWN, "99d23:59"));
+    
+    /* A minute widget is drawn as it is bound, then not again until the
+    * minute changes */
+    CHECK(SetClock(now, 0));
+    CHECK(DrawWrite(layout, sizeof(layout)) == CYBLE_GATT_ERR_NONE);
+    CHECK(ShowsCell(-14, 3, 6, '4') && ShowsCell(-14, 4, 6, '1'));
+    ClockService();
+    DrawTick();
+    StubReset();
+    StubSecond();
+    ClockService();
+    DrawTick();
+    CHECK(stubPackets == 0);
+    StubSecond();
+    ClockService();
+    DrawTick();
+    CHECK(ShowsCell(-14, 3, 6, '4') && ShowsCell(-14, 4, 6, '2') && (stubLatches > 0));
+    
+    /* A second widget sends only its seconds, every second */
+    CHECK(DrawWrite(seconds, sizeof(seconds)) == CYBLE_GATT_ERR_NONE);
+    DrawTick();
+    CHECK(ShowsCell(-32, 6, 6, '0') && ShowsCell(-32, 7, 6, '0'));
+    StubReset();
+    StubSecond();
+    ClockService();
+    DrawTick();
+    CHECK(ShowsCell(-32, 6, 6, '0') && ShowsCell(-32, 7, 6, '1') && (stubLatches > 0) && (stubLatches <= 6));
+    
+    /* Nothing is drawn while the panel shows something else */
+    displayMode = DISPLAY_MODE_TEXT;
+    StubReset();
+    StubSecond();
+    ClockService();
+    CHECK(stubPackets == 0);
+    
+    CHECK(DrawWrite(badKind, sizeof(badKind)) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    ClockWidget(0, CLOCK_NONE);
+    ClockWidget(1, CLOCK_NONE);
+    displayMode = DISPLAY_MODE_TEXT;
+}
+
+/* Window 'id' as a SCHEDULE Control write, into 'out' */
+static uint16 Window(uint8 *out, uint8 id, uint8 days, uint16 start, uint16 end, uint8 flags,
+    const char *batch)
+{
+    uint8 length = (uint8)strlen(batch);
+    uint16 crc;
+    
+    out[0] = id;
+    out[1] = days;
+    out[2] = LO8(start);
+    out[3] = HI8(start);
+    out[4] = LO8(end);
+    out[5] = HI8(end);
+    out[6] = flags;
+    out[7] = length;
+    memcpy(&out[SCHEDULE_HEADER], batch, length);
+    crc = ScheduleChecksum(out);
+    out[8] = LO8(crc);
+    out[9] = HI8(crc);
+    return SCHEDULE_HEADER + length;
+}
+
+/* The batch of the window applied last is 'batch' */
+static uint8 Applied(const char *batch)
+{
+    uint8 same = (stubBatch != NULL) && (memcmp(stubBatch, batch, strlen(batch)) == 0);
+    
+    stubBatch = NULL;
+    CommandApply();
+    return same;
+}
+
+static void TestSchedule(void)
+{
+    static const uint32 sunday = 1792281600u;   // 2026-10-18 00:00
+    static const uint32 day = 86400u;
+    static const uint32 hour = 3600u;
+    static const char weekdays[] = "\x03\x01\x0F\x01\x04" "Open";    // brightness 15, text
+    static const char sundays[] = "\x01\x06" "Closed";
+    uint8 write[SCHEDULE_SIZE];
+    uint16 length;
+    
+    /* Nights off, opening hours on weekdays and a sign all Sunday */
+    CHECK(ScheduleWrite(write, Window(write, 0, 0x7F, 22 * 60, 6 * 60, SCHEDULE_OFF, "")) == CYBLE_GATT_ERR_NONE);
+    CHECK(ScheduleWrite(write, Window(write, 1, 0x3E, 8 * 60, 18 * 60, 0, weekdays)) == CYBLE_GATT_ERR_NONE);
+    CHECK(ScheduleWrite(write, Window(write, 2, SCHEDULE_DAY(0), 0, 0, 0, sundays)) == CYBLE_GATT_ERR_NONE);
+    length = Window(write, 3, 0x7F, 0, 60, 0, "");
+    CHECK(ScheduleWrite(write, length - 1) == CYBLE_GATT_ERR_INVALID_ATTRIBUTE_LEN);
+    write[9] ^= 1;
+    CHECK(ScheduleWrite(write, length) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    CHECK(ScheduleWrite(write, Window(write, 3, 0x7F, SCHEDULE_MINUTES, 60, 0, "")) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    CHECK(ScheduleWrite(write, Window(write, SCHEDULE_COUNT, 0x7F, 0, 60, 0, "")) == CYBLE_GATT_ERR_OUT_OF_RANGE);
+    
+    /* Sunday morning: the Sunday sign, until the night window at 22:00 */
+    CHECK(SetClock(sunday + (9 * hour) + 1000, 0));
+    ScheduleService();
+    CHECK(Applied(sundays) && stubPower);
+    CHECK(ScheduleNextEdge(ClockNow()) == (sunday + (18 * hour)));
+    ScheduleService();
+    CHECK(stubBatch == NULL);
+    CHECK(SetClock(sunday + (22 * hour), 0));
+    ScheduleService();
+    CHECK(!stubPower && (stubBatch == NULL));
+    
+    /* The night carries over into Monday, which opens at 8:00 */
+    CHECK(SetClock(sunday + day + (6 * hour) - 1, 0));
+    ScheduleService();
+    CHECK(!stubPower);
+    StubSecond();
+    ScheduleService();
+    CHECK(stubPower && (stubBatch == NULL));
+    CHECK(SetClock(sunday + day + (8 * hour), 0));
+    ScheduleService();
+    CHECK(Applied(weekdays));
+    
+    /* A batch a client queued goes first */
+    CHECK(SetClock(sunday + day + (18 * hour), 0));
+    ScheduleService();
+    commandPending = TRUE;
+    CHECK(SetClock(sunday + (2 * day) + (8 * hour), 0));
+    ScheduleService();
+    CHECK(stubBatch == NULL);
+    CommandApply();
+    ScheduleService();
+    CHECK(Applied(weekdays));
+    
+    /* Deleting the night window while it is active wakes the panel */
+    CHECK(SetClock(sunday + (2 * day) + (23 * hour), 0));
+    ScheduleService();
+    CHECK(!stubPower);
+    CHECK(ScheduleWrite(write, Window(write, 0, 0, 0, 0, 0, "")) == CYBLE_GATT_ERR_NONE);
+    ScheduleService();
+    CHECK(stubPower && (stubBatch == NULL));
+    CHECK(ScheduleWrite(write, Window(write, 0, 0x7F, 22 * 60, 6 * 60, SCHEDULE_OFF, "")) == CYBLE_GATT_ERR_NONE);
+    
+    /* Windows outlast a reset, and go when deleted */
+    ScheduleInit();
+    CHECK(ScheduleActive(sunday + day + (9 * hour)) == 1);
+    CHECK(ScheduleWrite(write, Window(write, 0, 0, 0, 0, 0, "")) == CYBLE_GATT_ERR_NONE);
+    CHECK(ScheduleActive(sunday + (23 * hour)) == 2);
+    ScheduleWrite(write, Window(write, 1, 0, 0, 0, 0, ""));
+    ScheduleWrite(write, Window(write, 2, 0, 0, 0, 0, ""));
+    CHECK(ScheduleNextEdge(sunday) == ~(uint32)0);
+    ScheduleService();
+    CHECK(stubPower);
+}
+
+/* The columns zone 0 scrolls in for 's', as many as 'n' */
+static void Scrolled(const char *s, uint8 *columns, unsigned n)
+{
+    unsigned i;
+    
+    Start(s);
+    for (i = 0; i < n; i++)
+    {
+        ZoneTick();
+        columns[i] = r->window[r->width - 1];
+    }
+}
+
+/* What the panel shows once 's' is drawn, and whether it matches 'panel' */
+static uint8 ShowsSame(const char *s, const uint8 *panel)
+{
+    uint16 x;
+    
+    Start(s);
+    Ticks(1);
+    for (x = 0; x < FB_COLUMNS; x++)
+    {
+        if (FramebufferColumn(x) != panel[x])
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void Snapshot(uint8 *panel)
+{
+    uint16 x;
+    
+    for (x = 0; x < FB_COLUMNS; x++)
+    {
+        panel[x] = FramebufferColumn(x);
+    }
+}
+
+static void TestTemplate(void)
+{
+    uint8 got[160], want[160];
+    uint8 panel[FB_COLUMNS];
+    char name[VAR_NAME_SIZE];
+    unsigned i, room;
+    
+    /* {{ is a literal brace; bad names and unclosed braces are shown as typed */
+    Start("T{t} {{x} {Bad} {longername}{");
+    CHECK(r->opCount == 5);
+    CHECK(r->program[0].op == RENDER_OP_TEXT && r->program[0].length == 1);
+    CHECK(r->program[1].op == RENDER_OP_VAR && r->program[1].start == VarFind("t", 1, FALSE));
+    CHECK(r->program[2].op == RENDER_OP_TEXT && r->program[2].start == 4 && r->program[2].length == 2);
+    CHECK(r->program[3].op == RENDER_OP_TEXT && r->program[3].start == 7);
+    CHECK(VarFind("Bad", 3, FALSE) == VAR_NONE);
+    
+    /* A value scrolls exactly as the same text typed in would, and is read
+    * only when the scroll reaches it */
+    CHECK(VarSet("t", 1, "21.5", 4) && VarSet("q", 1, "", 0));
+    Scrolled("Temp {t}{q} C", got, sizeof(got));
+    Scrolled("Temp 21.5 C", want, sizeof(want));
+    CHECK(memcmp(got, want, sizeof(got)) == 0);
+    Start("Temp {t} C");
+    Ticks(10);
+    VarSet("t", 1, "-3", 2);
+    for (i = 0; i < sizeof(got); i++)
+    {
+        ZoneTick();
+        got[i] = r->window[r->width - 1];
+    }
+    Scrolled("Temp -3 C", want, sizeof(want));
+    CHECK(memcmp(got, &want[10], sizeof(got) - 10) == 0);
+    CHECK(!VarSet("time", 4, "12:00", 5));
+    
+    /* A still value is drawn again only when it changes */
+    VarSet("t", 1, "42", 2);
+    Start("<c>{t}");
+    Ticks(1);
+    Snapshot(panel);
+    CHECK(ShowsSame("<c>42", panel));
+    Start("<c>{t}");
+    Ticks(1);
+    StubReset();
+    Ticks(20);
+    CHECK(stubPackets == 0);
+    VarSet("t", 1, "7", 1);
+    Ticks(1);
+    CHECK(stubLatches > 0);
+    Snapshot(panel);
+    CHECK(ShowsSame("<c>7", panel));
+    
+    /* {time} comes from the clock */
+    CHECK(SetClock(1792316518u, 0));
+    Scrolled("{time}", got, sizeof(got));
+    Scrolled("09:41", want, sizeof(want));
+    CHECK(memcmp(got, want, sizeof(got)) == 0);
+    
+    /* Names only a message used are given back once it is replaced */
+    room = VarRoom();
+    Start("{ok} {a1} {a2} {ok}");
+    CHECK(VarRoom() == room - 3);
+    Start("{ok}");
+    CHECK(VarRoom() == room - 1);
+    Start("");
+    CHECK(VarRoom() == room);
+    
+    /* Values a write set keep their entries; with the table full of them a
+    * new name is neither set nor given an entry, which is what ParseBatch
+    * refuses a VAR record for */
+    for (i = 0; VarRoom() != 0; i++)
+    {
+        snprintf(name, sizeof(name), "v%u", i);
+        CHECK(VarSet(name, (uint8)strlen(name), "1", 1));
+    }
+    Start("{ok}");
+    CHECK(r->opCount == 2 && r->program[0].op == RENDER_OP_TEXT);
+    CHECK(!VarSet("new", 3, "1", 1) && (VarFind("new", 3, FALSE) == VAR_NONE));
+    CHECK(VarSet("t", 1, "1", 1));
+}
+
+/* Whether the panel shows 's', centred the way a page line is, with each
+* column shifted down 'down' rows; rows pushed off the bottom are gone */
+static uint8 ShowsLine(const char *s, uint8 down)
+{
+    uint16 next, width, x;
+    uint16 end = PageWrap(s, (uint16)strlen(s), 0, &next, &width);
+    uint8 want[FB_WIDTH] = { 0 };
+    const uint8 *columns;
+    uint8 extent, c;
+    uint16 i;
+    
+    x = (FB_WIDTH - width) / 2;
+    for (i = 0; i < end; i++, x++)
+    {
+        extent = GlyphExtent((uint8)s[i]);
+        columns = GlyphColumns((uint8)s[i]) + FONT_EXTENT_FIRST(extent);
+        for (c = 0; c < FONT_EXTENT_WIDTH(extent); c++, x++)
+        {
+            want[x] = columns[c];
+        }
+    }
+    for (x = 0; x < FB_WIDTH; x++)
+    {
+        if (FramebufferColumn(x) != (uint8)(want[x] << down))
+        {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static void PageTicks(unsigned n)
+{
+    while (n--)
+    {
+        PageTick();
+        FramebufferCommit();
+    }
+}
+
+static void TestPage(void)
+{
+    static const char words[] = "Hi it\nok";
+    TEXT_DESC_T desc = { words, sizeof(words) - 1, TEXT_SOURCE_RAM };
+    uint16 next, width, end;
+    
+    /* Lines break before a space, at a '\n', or inside a word too wide */
+    end = PageWrap(words, desc.length, 0, &next, &width);
+    CHECK(end == 2 && next == 3 && width <= FB_WIDTH);
+    end = PageWrap(words, desc.length, 3, &next, &width);
+    CHECK(end == 5 && next == 6);
+    end = PageWrap("WWWWWWWW", 8, 0, &next, &width);
+    CHECK(end == next && end > 0 && end < 8 && width <= FB_WIDTH);
+    end = PageWrap("", 0, 0, &next, &width);
+    CHECK(end == 0 && next == 0 && width == 0);
+    
+    /* Each page comes in from below a pixel row a tick, then holds */
+    stubTickRate = 10;
+    FramebufferClear();
+    PageStart(&desc, 3);
+    PageTicks(4);
+    CHECK(ShowsLine("Hi", 4));
+    PageTicks(4);
+    CHECK(ShowsLine("Hi", 0));
+    PageTicks(3);
+    CHECK(ShowsLine("Hi", 0));
+    PageTicks(1 + FB_HEIGHT);
+    CHECK(ShowsLine("it", 0));
+    PageTicks(3 + FB_HEIGHT);
+    CHECK(ShowsLine("ok", 0));
+    PageTicks(3 + FB_HEIGHT);
+    CHECK(ShowsLine("Hi", 0));
+    
+    /* A message that fits on one page is never scrolled again */
+    desc.text = "5";
+    desc.length = 1;
+    PageStart(&desc, 1);
+    PageTicks(FB_HEIGHT);
+    CHECK(ShowsLine("5", 0));
+    StubReset();
+    PageTicks(50);
+    CHECK(stubPackets == 0);
+}
+
+int main(void)
+{
+    FramebufferInit();
+    ZoneInit();
+    
+    /* Until TestProportional the checks count cells of 8 columns */
+    ZoneSpacing(0, RENDER_FIXED);
+    ZoneSpacing(1, RENDER_FIXED);
+    TestCompile();
+    TestScroll();
+    TestControl();
+    TestBlink();
+    TestSplice();
+    TestUtf8();
+    TestEffects();
+    TestZones();
+    TestProportional();
+    TestSprite();
+    TestDraw();
+    TestField();
+    TestClock();
+    TestSchedule();
+    TestTemplate();
+    TestPage();
+    
+    printf("rendertest: %s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
+
+/* [] END OF FILE */
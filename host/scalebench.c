@@ -0,0 +1,158 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* Scaled text on a panel three module rows tall, built with the geometry
+* given by the Makefile. Checks that every pixel a scaled zone shows is the
+* pixel of the normal size column it was stretched from, then measures the
+* host time of a scroll step at each size, and of stretching a column with
+* the lookup tables against doing it pixel by pixel. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Zone.h>
+#include <Framebuffer.h>
+#include <Scale.h>
+
+#define STEPS       100000
+#define COLUMNS     2000000
+
+static const struct
+{
+    const char *name;
+    uint8 size;
+} sizes[] =
+{
+    { "1x",             SCALE_1X },
+    { "double height",  SCALE_TALL },
+    { "2x",             SCALE_2X },
+    { "3x",             SCALE_3X },
+};
+
+/* The same stretch a pixel at a time, to compare against */
+static uint32 Naive(uint8 bits, uint8 height)
+{
+    uint32 tall = 0;
+    uint8 y, i;
+    
+    for (y = 0; y < 8; y++)
+    {
+        for (i = 0; i < height; i++)
+        {
+            if (bits & (1u << y))
+            {
+                tall |= 1ul << ((y * height) + i);
+            }
+        }
+    }
+    return tall;
+}
+
+/* Pixel (x, y) of the panel must be pixel (x / width, y / height) of what
+* the zone rendered, and the module rows below the text blank */
+static int CheckZone(uint8 size)
+{
+    const RENDER_T *r = &zones[0].render;
+    uint8 width = SCALE_WIDTH(size);
+    uint8 height = SCALE_HEIGHT(size);
+    uint16 x, y;
+    uint8 lit, want;
+    int errors = 0;
+    
+    for (y = 0; y < FB_HEIGHT; y++)
+    {
+        for (x = 0; x < FB_WIDTH; x++)
+        {
+            lit = (FramebufferColumn(((y / 8) * FB_WIDTH) + x) >> (y % 8)) & 1u;
+            want = (y < (8 * height)) ? ((r->window[x / width] >> (y / height)) & 1u) : 0;
+            errors += (lit != want);
+        }
+    }
+    return errors;
+}
+
+int main(void)
+{
+    static const char still[] = "<l>Hi!";
+    static const char scroll[] = "Doors open at 9, last entry 17:30. Have a nice day!";
+    TEXT_DESC_T text = { still, sizeof(still) - 1, TEXT_SOURCE_RAM };
+    static volatile uint32 sink;
+    uint8 scene[FB_COLUMNS];
+    unsigned s, n;
+    int errors, total = 0;
+    double t0, step, table, naive;
+    
+    stubTickRate = 1000;
+    FramebufferInit();
+    ZoneInit();
+    printf("%u x %u modules\n\n", PANEL_COLUMNS, PANEL_ROWS);
+    printf("%-14s %8s %8s %12s\n", "size", "pixels", "layout", "ns/step");
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        text.text = still;
+        text.length = sizeof(still) - 1;
+        ZoneSize(0, sizes[s].size);
+        ZoneStart(0, &text);
+        ZoneTick();
+        errors = CheckZone(sizes[s].size);
+        total += errors;
+    
+        text.text = scroll;
+        text.length = sizeof(scroll) - 1;
+        ZoneStart(0, &text);
+        t0 = StubTime();
+        for (n = 0; n < STEPS; n++)
+        {
+            ZoneTick();
+        }
+        step = (StubTime() - t0) * 1e9 / STEPS;
+        printf("%-14s %5ux%-2u %8s %12.1f\n", sizes[s].name, SCALE_WIDTH(sizes[s].size) * 8,
+            SCALE_HEIGHT(sizes[s].size) * 8, errors ? "WRONG" : "ok", step);
+    }
+    ZoneSize(0, SCALE_1X);
+    
+    /* Stretching one rendered column, and a zone's worth of them */
+    printf("\n%-14s %12s %12s %14s\n", "height", "table ns", "naive ns", "ns/panel col");
+    for (s = 1; s <= 3; s++)
+    {
+        t0 = StubTime();
+        for (n = 0; n < COLUMNS; n++)
+        {
+            sink ^= ScaleColumn((uint8)n, (uint8)s);
+        }
+        table = (StubTime() - t0) * 1e9 / COLUMNS;
+        t0 = StubTime();
+        for (n = 0; n < COLUMNS; n++)
+        {
+            sink ^= Naive((uint8)n, (uint8)s);
+        }
+        naive = (StubTime() - t0) * 1e9 / COLUMNS;
+        t0 = StubTime();
+        for (n = 0; n < (COLUMNS / FB_WIDTH); n++)
+        {
+            ScaleColumns(zones[0].render.window, (uint8)((s << 4) | s), scene, FB_WIDTH);
+            sink ^= scene[n % FB_WIDTH];
+        }
+        printf("%-14u %12.1f %12.1f %14.1f\n", s * 8, table, naive,
+            (StubTime() - t0) * 1e9 / ((COLUMNS / FB_WIDTH) * FB_WIDTH));
+        for (n = 0; n < 256; n++)
+        {
+            total += (ScaleColumn((uint8)n, (uint8)s) != Naive((uint8)n, (uint8)s));
+        }
+    }
+    
+    if (total != 0)
+    {
+        printf("%d pixels scaled wrong\n", total);
+        return 1;
+    }
+    return 0;
+}
+
+/* [] END OF FILE */
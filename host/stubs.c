@@ -0,0 +1,273 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#include <stubs.h>
+#include <Flash.h>
+
+const uint8 MAX7219_REG_NOOP        = 0x0;
+const uint8 MAX7219_REG_DIGIT0      = 0x1;
+const uint8 MAX7219_REG_INTENSITY   = 0xA;
+
+volatile uint8 displayMode = DISPLAY_MODE_TEXT;
+
+uint32 stubPackets;
+uint32 stubLatches;
+uint8 stubIntensity[MODULE_COUNT];
+uint8 stubDigits[MODULE_COUNT][8];
+uint32 stubNoops;
+static uint8 latchPacket;           // packets since CS went low
+uint16 stubTickRate = 10;
+uint32 stubPeriod = DisplayTimer_TC_PERIOD_VALUE;
+uint16 stubDivider;
+uint32 stubFlashRows;
+uint8 stubFlashBusy;
+uint8 stubAttribute[8];
+uint8 stubPower = TRUE;
+const uint8 *stubBatch;
+volatile uint8 commandPending;
+static cyWdtCallback wdtCallback;
+CYBLE_CONN_HANDLE_T cyBle_connHandle;
+
+void StubReset(void)
+{
+    stubPackets = 0;
+    stubLatches = 0;
+    stubNoops = 0;
+}
+
+void CS_Write(uint8 value)
+{
+    if (value == HIGH)
+    {
+        stubLatches++;
+    }
+    latchPacket = 0;
+}
+
+void CyDelayUs(uint32 us)
+{
+    (void)us;
+}
+
+void SendPacketNoCS(const uint8 reg, uint8 data)
+{
+    if ((reg == MAX7219_REG_INTENSITY) && (latchPacket < MODULE_COUNT))
+    {
+        stubIntensity[latchPacket] = data;
+    }
+    if ((reg >= MAX7219_REG_DIGIT0) && (reg < (MAX7219_REG_DIGIT0 + 8)) && (latchPacket < MODULE_COUNT))
+    {
+        stubDigits[latchPacket][reg - MAX7219_REG_DIGIT0] = data;
+    }
+    if (reg == MAX7219_REG_NOOP)
+    {
+        stubNoops++;
+    }
+    latchPacket++;
+    stubPackets++;
+}
+
+uint32 MAX7219_SpiUartGetTxBufferSize(void)
+{
+    return 0;
+}
+
+uint32 MAX7219_SpiIsBusBusy(void)
+{
+    return 0;
+}
+
+void DisplayTimer_WritePeriod(uint32 period)
+{
+    stubPeriod = period;
+}
+
+void Timer_CLK_Stop(void)
+{
+}
+
+void Timer_CLK_Start(void)
+{
+}
+
+void Timer_CLK_SetDividerValue(uint16 clkDivider)
+{
+    stubDivider = clkDivider;
+}
+
+void CySysWdtUnlock(void)
+{
+}
+
+void CySysWdtLock(void)
+{
+}
+
+void CySysWdtSetMode(uint32 counterNum, uint32 mode)
+{
+    (void)counterNum;
+    (void)mode;
+}
+
+void CySysWdtSetMatch(uint32 counterNum, uint32 match)
+{
+    (void)counterNum;
+    (void)match;
+}
+
+void CySysWdtSetClearOnMatch(uint32 counterNum, uint32 enable)
+{
+    (void)counterNum;
+    (void)enable;
+}
+
+cyWdtCallback CySysWdtSetInterruptCallback(uint32 counterNum, cyWdtCallback function)
+{
+    cyWdtCallback previous = wdtCallback;
+    
+    (void)counterNum;
+    wdtCallback = function;
+    return previous;
+}
+
+void CySysWdtEnable(uint32 counterMask)
+{
+    (void)counterMask;
+}
+
+void CySysWdtResetCounters(uint32 countersMask)
+{
+    (void)countersMask;
+}
+
+void CySysWdtIsr(void)
+{
+    if (wdtCallback != NULL)
+    {
+        wdtCallback();
+    }
+}
+
+void StubSecond(void)
+{
+    CySysWdtIsr();
+}
+
+double StubTime(void)
+{
+    struct timespec t;
+    
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+cyisraddress CyIntSetVector(uint8 number, cyisraddress address)
+{
+    (void)number;
+    return address;
+}
+
+void CyIntEnable(uint8 number)
+{
+    (void)number;
+}
+
+/* The host runs no interrupts */
+uint8 CyEnterCriticalSection(void)
+{
+    return 0;
+}
+
+void CyExitCriticalSection(uint8 savedIntrStatus)
+{
+    (void)savedIntrStatus;
+}
+
+CYBLE_GATT_ERR_CODE_T CyBle_GattsWriteAttributeValue(CYBLE_GATT_HANDLE_VALUE_PAIR_T *handleValuePair,
+    uint16 offset, CYBLE_CONN_HANDLE_T *connHandle, uint8 flags)
+{
+    uint16 length = handleValuePair->value.len;
+    
+    (void)offset;
+    (void)connHandle;
+    (void)flags;
+    memcpy(stubAttribute, handleValuePair->value.val, (length < sizeof(stubAttribute)) ? length : sizeof(stubAttribute));
+    return CYBLE_GATT_ERR_NONE;
+}
+
+void DisplayPower(uint8 on)
+{
+    stubPower = on;
+}
+
+/* Batches are not parsed on the host; one is queued until CommandApply */
+CYBLE_GATT_ERR_CODE_T CommandValid(const uint8 *data, uint16 length)
+{
+    (void)data;
+    (void)length;
+    return commandPending ? GATT_ERR_BUSY : CYBLE_GATT_ERR_NONE;
+}
+
+CYBLE_GATT_ERR_CODE_T CommandSchedule(const uint8 *data, uint16 length)
+{
+    if (commandPending)
+    {
+        return GATT_ERR_BUSY;
+    }
+    (void)length;
+    stubBatch = data;
+    commandPending = TRUE;
+    return CYBLE_GATT_ERR_NONE;
+}
+
+void CommandApply(void)
+{
+    commandPending = FALSE;
+}
+
+/* Flash stores are const and may end up in read-only pages on the host; the
+* row write makes its page writable first, as the SPC would */
+CYBLE_GATT_ERR_CODE_T FlashWriteRow(const volatile uint8 *row, const uint8 *data)
+{
+    uintptr_t page = (uintptr_t)row & ~(uintptr_t)(sysconf(_SC_PAGESIZE) - 1);
+    
+    if (stubFlashBusy)
+    {
+        return GATT_ERR_BUSY;
+    }
+    if (mprotect((void *)page, (uintptr_t)row + FLASH_ROW_SIZE - page, PROT_READ | PROT_WRITE) != 0)
+    {
+        return CYBLE_GATT_ERR_UNLIKELY_ERROR;
+    }
+    memcpy((uint8 *)row, data, FLASH_ROW_SIZE);
+    stubFlashRows++;
+    return CYBLE_GATT_ERR_NONE;
+}
+
+uint16 DisplayTickRate(void)
+{
+    return stubTickRate;
+}
+
+uint16 DisplayStepRate(uint8 divider)
+{
+    (void)divider;
+    return stubTickRate;
+}
+
+void DisplayBaseSpeed(void)
+{
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,37 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+#ifndef _STUBS_H_
+#define _STUBS_H_
+
+#include <main.h>
+
+/* What the firmware modules did to the hardware, for the host programs */
+extern uint32 stubPackets;          // MAX7219 packets sent
+extern uint32 stubLatches;          // CS rising edges
+extern uint8 stubIntensity[MODULE_COUNT];   // last intensity sent to each chain position
+extern uint8 stubDigits[MODULE_COUNT][8];   // last digit registers sent to each chain position
+extern uint32 stubNoops;            // no-op packets sent
+extern uint16 stubTickRate;         // returned by DisplayTickRate and DisplayStepRate
+extern uint32 stubPeriod;           // last DisplayTimer period written
+extern uint16 stubDivider;          // last Timer_CLK divider set
+extern uint32 stubFlashRows;        // rows of flash written
+extern uint8 stubFlashBusy;         // TRUE: the BLE stack has no room for a row write
+extern uint8 stubAttribute[8];      // first bytes of the last attribute value written
+extern uint8 stubPower;             // last DisplayPower
+extern const uint8 *stubBatch;      // last batch given to CommandSchedule
+
+void StubReset(void);
+void StubSecond(void);              // a WDT counter 0 match
+double StubTime(void);              // monotonic host time in seconds, for the benches
+
+#endif
+/* [] END OF FILE */
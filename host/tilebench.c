@@ -0,0 +1,160 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* The framebuffer on a tiled wall, built with the geometry given by the
+* Makefile. Checks that every module gets its own pixels through the layout
+* and orientation tables, then measures a scroll and commit for walls with more and more of
+* their module rows lit: packets that carry data, which cost a column read,
+* against no-ops, and the host time per frame. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Framebuffer.h>
+
+#define FRAMES      2000
+
+/* The column and pixel shown by bit 's' of digit 'd' of a module mounted
+* 'orient' */
+static void Source(uint8 orient, uint8 d, uint8 s, uint8 *x, uint8 *y)
+{
+    switch (orient & 3)
+    {
+        case MODULE_ROT_0:   *x = d;     *y = s;     break;
+        case MODULE_ROT_90:  *x = 7 - s; *y = d;     break;
+        case MODULE_ROT_180: *x = 7 - d; *y = 7 - s; break;
+        default:             *x = s;     *y = 7 - d; break;
+    }
+    if (orient & MODULE_MIRROR)
+    {
+        *x = 7 - *x;
+    }
+}
+
+/* Every module gets different columns; each digit is checked bit by bit */
+static int CheckLayout(void)
+{
+    uint8 columns[FB_COLUMNS];
+    uint32 seed = 1;
+    uint16 c;
+    uint8 module, digit, s, x, y, want;
+    int errors = 0;
+    
+    for (c = 0; c < FB_COLUMNS; c++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        columns[c] = (uint8)(seed >> 16);
+    }
+    FramebufferClear();
+    FramebufferWrite(0, columns, FB_COLUMNS);
+    FramebufferCommit();
+    
+    for (module = 0; module < MODULE_COUNT; module++)
+    {
+        for (digit = 0; digit < 8; digit++)
+        {
+            want = 0;
+            for (s = 0; s < 8; s++)
+            {
+                Source(panelOrient[module], digit, s, &x, &y);
+                want |= ((columns[(module * 8) + x] >> y) & 1u) << s;
+            }
+            errors += (stubDigits[panelLayout[module]][digit] != want);
+        }
+    }
+    return errors;
+}
+
+int main(void)
+{
+    static const uint8 lit[8] = { 0x7E, 0x81, 0x81, 0x7E, 0x00, 0xFF, 0x08, 0xFF };
+    uint8 rows;
+    int errors;
+    unsigned f;
+    
+    FramebufferInit();
+    errors = CheckLayout();
+    printf("%u x %u modules, %u words per pixel row, layout %s\n\n",
+        PANEL_COLUMNS, PANEL_ROWS, FB_WORDS, errors ? "WRONG" : "ok");
+    
+    /* One changed column of an upright module row: one latch, data only for
+    * that row. In a quarter turned row it crosses every digit. */
+    FramebufferCommit();
+    StubReset();
+    FramebufferWrite(3, lit, 1);
+    FramebufferCommit();
+    printf("one column changed: %u latch, %u data packets, %u no-ops\n",
+        stubLatches, stubPackets - stubNoops, stubNoops);
+    if ((stubLatches != 1) || ((stubPackets - stubNoops) != PANEL_COLUMNS))
+    {
+        errors++;
+    }
+    if (PANEL_ROWS > 2)
+    {
+        StubReset();
+        FramebufferWrite((2 * FB_WIDTH) + 3, lit, 1);
+        FramebufferCommit();
+        printf("one column changed in a quarter turned row: %u latches, %u data packets, %u no-ops\n",
+            stubLatches, stubPackets - stubNoops, stubNoops);
+    }
+    printf("\n");
+    
+    printf("%-10s %10s %14s %10s %12s\n", "lit rows", "latches", "data packets", "no-ops", "host ns");
+    for (rows = 0; rows <= PANEL_ROWS; rows++)
+    {
+        double t0, spent = 0;
+        uint8 line;
+        
+        /* Fill the first 'rows' module rows, scroll blank columns into the rest */
+        FramebufferClear();
+        for (line = 0; line < rows; line++)
+        {
+            uint16 x;
+            
+            for (x = 0; x < FB_WIDTH; x++)
+            {
+                FramebufferWrite((line * FB_WIDTH) + x, &lit[x % 8], 1);
+            }
+        }
+        FramebufferCommit();
+        
+        StubReset();
+        for (f = 0; f < FRAMES; f++)
+        {
+            t0 = StubTime();
+            FramebufferScroll((rows == PANEL_ROWS) ? lit[f % 8] : 0);
+            FramebufferCommit();
+            spent += StubTime() - t0;
+            if ((rows < PANEL_ROWS) && ((f % FB_COLUMNS) == (FB_COLUMNS - 1)))
+            {
+                /* The lit rows have scrolled away: put them back */
+                for (line = 0; line < rows; line++)
+                {
+                    uint16 x;
+                    
+                    for (x = 0; x < FB_WIDTH; x++)
+                    {
+                        FramebufferWrite((line * FB_WIDTH) + x, &lit[x % 8], 1);
+                    }
+                }
+                FramebufferCommit();
+            }
+        }
+        printf("%-10u %10.1f %14.1f %10.1f %12.1f\n", rows, (double)stubLatches / FRAMES,
+            (double)(stubPackets - stubNoops) / FRAMES, (double)stubNoops / FRAMES, spent * 1e9 / FRAMES);
+    }
+    
+    if (errors)
+    {
+        printf("\nFAIL: %d modules or latches did not match the layout\n", errors);
+    }
+    return errors != 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,151 @@
+/* ========================================
+ *
+ * Copyright YOUR COMPANY, THE YEAR
+ * All Rights Reserved
+ * UNPUBLISHED, LICENSED SOFTWARE.
+ *
+ * CONFIDENTIAL AND PROPRIETARY INFORMATION
+ * WHICH IS THE PROPERTY OF your company.
+ *
+ * ========================================
+*/
+/* A message with a variable in every free entry of the table against the
+* same text typed in.
+* Checks that the template scrolls exactly the columns of its expansion and
+* that setting a value leaves the scroll where it was, then measures the
+* host time to compile each, of a scroll step, mean and worst, and of
+* setting a value, and the bytes a value costs over BLE against sending the
+* message again. */
+#include <stdio.h>
+#include <stubs.h>
+#include <Zone.h>
+#include <Framebuffer.h>
+#include <Command.h>
+#include <Var.h>
+
+#define VARS        (VAR_COUNT - VAR_BUILT_IN)
+#define STARTS      100000
+#define SETS        1000000
+
+static char templ[MESSAGE_SIZE + 1];
+static char expanded[2 * MESSAGE_SIZE];
+static char names[VARS][VAR_NAME_SIZE + 1];
+static char values[VARS][VAR_VALUE_SIZE + 1];
+
+/* Queue lengths at each gate, "Gate 1: {g0}m Gate 2: {g1}m ..." */
+static void Build(void)
+{
+    char piece[sizeof("Gate 256: {}m ") + VAR_VALUE_SIZE];    // either piece at its longest
+    uint8 i;
+    
+    templ[0] = 0;
+    expanded[0] = 0;
+    for (i = 0; i < VARS; i++)
+    {
+        snprintf(names[i], sizeof(names[i]), "g%u", i);
+        snprintf(values[i], sizeof(values[i]), "%u", (i * 7u) % 23u);
+        VarSet(names[i], (uint8)strlen(names[i]), values[i], (uint8)strlen(values[i]));
+        snprintf(piece, sizeof(piece), "Gate %u: {%s}m ", i + 1, names[i]);
+        strcat(templ, piece);
+        snprintf(piece, sizeof(piece), "Gate %u: %sm ", i + 1, values[i]);
+        strcat(expanded, piece);
+    }
+}
+
+/* Runs 'steps' scroll steps of zone 0, the mean and worst host time of one,
+* and the columns scrolled in if 'columns' is not NULL */
+static void Steps(unsigned steps, uint8 *columns, double *mean, double *worst)
+{
+    const RENDER_T *r = &zones[0].render;
+    double t0, t1, start = StubTime();
+    unsigned n;
+    
+    *worst = 0;
+    for (n = 0; n < steps; n++)
+    {
+        t0 = StubTime();
+        ZoneTick();
+        t1 = StubTime();
+        if ((t1 - t0) > *worst)
+        {
+            *worst = t1 - t0;
+        }
+        if (columns != NULL)
+        {
+            columns[n] = r->window[r->width - 1];
+        }
+    }
+    *mean = (StubTime() - start) * 1e9 / steps;
+    *worst *= 1e9;
+}
+
+int main(void)
+{
+    static uint8 got[8 * 2 * MESSAGE_SIZE], want[8 * 2 * MESSAGE_SIZE];
+    static volatile uint32 sink;
+    TEXT_DESC_T text = { templ, 0, TEXT_SOURCE_RAM };
+    TEXT_DESC_T plain = { expanded, 0, TEXT_SOURCE_RAM };
+    const RENDER_T *r = &zones[0].render;
+    unsigned n, pass, pc, step, ops;
+    double t0, compile[2], mean[2], worst[2], set;
+    int errors = 0;
+    
+    stubTickRate = 1000;
+    FramebufferInit();
+    ZoneInit();
+    Build();
+    text.length = (uint16)strlen(templ);
+    plain.length = (uint16)strlen(expanded);
+    
+    /* A whole pass of each, and a second one of the template */
+    ZoneStart(0, &plain);
+    pass = r->columns + r->width;
+    Steps(pass, want, &mean[1], &worst[1]);
+    ZoneStart(0, &text);
+    ops = r->opCount;
+    Steps(pass, got, &mean[0], &worst[0]);
+    errors += (memcmp(got, want, pass) != 0);
+    Steps(pass, got, &mean[0], &worst[0]);
+    errors += (memcmp(got, want, pass) != 0);
+    
+    /* A value set halfway through the scroll leaves it where it was */
+    Steps(pass / 2, NULL, &mean[0], &worst[0]);
+    pc = r->pc;
+    step = r->step;
+    VarSet(names[VARS - 1], (uint8)strlen(names[VARS - 1]), "99", 2);
+    errors += (r->pc != pc) || (r->step != step);
+    
+    for (n = 0; n < 2; n++)
+    {
+        t0 = StubTime();
+        for (pass = 0; pass < STARTS; pass++)
+        {
+            ZoneStart(0, n ? &plain : &text);
+        }
+        compile[n] = (StubTime() - t0) * 1e9 / STARTS;
+    }
+    t0 = StubTime();
+    for (n = 0; n < SETS; n++)
+    {
+        sink ^= VarSet(names[n % VARS], (uint8)strlen(names[n % VARS]), values[(n + 1) % VARS], 2);
+    }
+    set = (StubTime() - t0) * 1e9 / SETS;
+    
+    printf("%u modules, %u variables, template %u bytes, %u ops\n\n", MODULE_COUNT, VARS,
+        (unsigned)text.length, ops);
+    printf("%-10s %8s %12s %12s %12s %8s\n", "", "bytes", "compile ns", "ns/step", "worst ns", "scroll");
+    printf("%-10s %8u %12.1f %12.1f %12.1f %8s\n", "template", (unsigned)text.length, compile[0], mean[0],
+        worst[0], errors ? "WRONG" : "same");
+    printf("%-10s %8u %12.1f %12.1f %12.1f\n", "typed", (unsigned)plain.length, compile[1], mean[1], worst[1]);
+    printf("\nsetting a value: %.1f ns, %u bytes in a COMMAND record against %u to send the message again\n",
+        set, 2 + 1 + 3 + 2, (unsigned)plain.length + 2);
+    
+    if (errors != 0)
+    {
+        printf("template scrolled wrong\n");
+        return 1;
+    }
+    return 0;
+}
+
+/* [] END OF FILE */